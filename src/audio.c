@@ -3,74 +3,104 @@
 */
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
 
 #include "SDL2/SDL.h"
 
 #include "qp.h"
 #include "audio.h"
-#include "lib/vgm.h"
 
-void QP_AudioCallback(void* data,Uint8* astream,int len)
+QP_Audio *Audio;
+
+// Get the next frame from the chip buffer, rendering more if needed.
+static void QP_AudioNextFrame(QP_AudioCallbackData* S)
 {
-    QP_AudioCallbackData* S = (QP_AudioCallbackData*)data;
-    float* stream = (float*)astream;
+    if(S->ChipBufferPos >= S->ChipBufferLen)
+    {
+        S->ChipBufferLen = DriverRender(S->Context,S->ChipBuffer,QPAUDIO_CHIP_BUFFER_SIZE,4);
+        S->ChipBufferPos = 0;
+    }
+
+    memcpy(S->ChipOut,&S->ChipBuffer[S->ChipBufferPos*4],sizeof(S->ChipOut));
+    if(S->MuteRear)
+        S->ChipOut[2] = S->ChipOut[3] = 0;
+    S->ChipBufferPos++;
+}
+
+// Get the next frame at the device rate from the resampler, feeding it
+// with chip rate frames as needed.
+static void QP_AudioNextResampledFrame(QP_AudioCallbackData* S)
+{
+    int count;
+
+    while(S->ResampleBufferPos >= S->ResampleBufferLen)
+    {
+        S->ResampleBufferLen = resampler_read(&S->Resampler,S->ResampleBuffer,QPAUDIO_CHIP_BUFFER_SIZE);
+        S->ResampleBufferPos = 0;
+        if(!S->ResampleBufferLen)
+        {
+            count = DriverRender(S->Context,S->ChipBuffer,QPAUDIO_CHIP_BUFFER_SIZE,4);
+            resampler_write(&S->Resampler,S->ChipBuffer,count);
+        }
+    }
+
+    memcpy(S->ChipOut,&S->ResampleBuffer[S->ResampleBufferPos*4],sizeof(S->ChipOut));
+    if(S->MuteRear)
+        S->ChipOut[2] = S->ChipOut[3] = 0;
+    S->ResampleBufferPos++;
+}
+
+// Render one device buffer (SampleCount frames) at the output rate.
+static void QP_AudioRender(QP_AudioCallbackData* S,float* out)
+{
+    QP_Context* ctx = S->Context;
+    float* stream = out;
+    float* ChipOut = S->ChipOut;
 
     int i,j;
-    float ChipOut[4] = {0,0,0,0};
 
     int updatemode = S->UpdateRequest;
 
-    double ChipDelta = (double)DriverGetChipRate()/S->SampleRate;
-    double DriverDelta = (double)DriverGetTickRate()/S->SampleRate;
+    double ChipDelta = (double)DriverGetChipRate(ctx)/S->SampleRate;
 
+    ctx->TickScale = 1.0;
     if(S->FastForward)
-        DriverDelta *= 32;
+        ctx->TickScale = 32;
+    if(~updatemode & QPAUDIO_DRV_PLAY)
+        ctx->TickScale = 0;
 
     for(i=0;i<S->SampleCount;i++)
     {
-        if(updatemode & QPAUDIO_DRV_PLAY)
+        if(updatemode & QPAUDIO_CHIP_PLAY && S->Resample)
         {
-            S->DriverUpdate += DriverDelta;
-            while(S->DriverUpdate > 1)
-            {
-                DriverUpdateTick();
-                //Q_UpdateTick(S->QDrv);
-
-                if(Game->VgmLog)
-                {
-                    vgm_delay(441000/DriverGetTickRate());
-                }
-                S->DriverUpdate-=1;
-
-                GameDoUpdate(Game);
-            }
+            QP_AudioNextResampledFrame(S);
         }
-        if(updatemode & QPAUDIO_CHIP_PLAY)
+        else if(updatemode & QPAUDIO_CHIP_PLAY)
         {
             S->ChipUpdate += ChipDelta;
             while(S->ChipUpdate > 1)
             {
-                DriverUpdateChip();
+                QP_AudioNextFrame(S);
                 S->ChipUpdate-=1;
             }
-
-            DriverSampleChip(ChipOut,S->MuteRear ? 2 : 4);
         }
         if(~updatemode & QPAUDIO_MUTE)
         {
             if(S->OutChannels==1)
-                *stream = S->Gain*(ChipOut[0]+ChipOut[1]+ChipOut[2]+ChipOut[3]);
+                *stream = (ChipOut[0]+ChipOut[1]+ChipOut[2]+ChipOut[3]);
             else if(S->OutChannels==2)
             {
-                stream[0] = S->Gain*(ChipOut[0]+ChipOut[2]);
-                stream[1] = S->Gain*(ChipOut[1]+ChipOut[3]);
+                stream[0] = (ChipOut[0]+ChipOut[2]);
+                stream[1] = (ChipOut[1]+ChipOut[3]);
             }
             else if(S->OutChannels==4)
             {
-                stream[0] = S->Gain*ChipOut[0];
-                stream[1] = S->Gain*ChipOut[1];
-                stream[2] = S->Gain*ChipOut[2];
-                stream[3] = S->Gain*ChipOut[3];
+                stream[0] = ChipOut[0];
+                stream[1] = ChipOut[1];
+                stream[2] = ChipOut[2];
+                stream[3] = ChipOut[3];
             }
             else
             {
@@ -88,25 +118,136 @@ void QP_AudioCallback(void* data,Uint8* astream,int len)
         stream += S->OutChannels;
     }
 
-    if(S->FileLogging)
+    // QP_AudioWavClose waits until LogBusy is cleared before stopping
+    // the writer
+    SDL_AtomicSet(&S->LogBusy,1);
+    if(SDL_AtomicGet(&S->FileLogging))
     {
-        fwrite(astream,S->OutChannels*4,S->SampleCount,S->logfile);
-        S->LogSamples += S->SampleCount;
+        // drop the whole buffer rather than wait for the writer
+        uint32_t count = S->SampleCount*S->OutChannels;
+        if(ring_writable(&S->LogRing) < count)
+            SDL_AtomicAdd(&S->LogOverflows,S->SampleCount);
+        else
+            ring_write(&S->LogRing,out,count);
+        if(ring_readable(&S->LogRing) >= QPAUDIO_LOG_BLOCK)
+            SDL_SemPost(S->LogWake);
     }
+    if(SDL_AtomicSet(&S->LogBusy,0) == 2)
+        SDL_SemPost(S->LogIdle);
 
 }
 
-int QP_AudioInit(QP_Audio* audio,int SampleRate,int SampleCount,int ChannelCount,char *AudioDevice)
+// Producer thread, keeps the ring buffer filled.
+static int QP_AudioProducer(void* data)
+{
+    QP_AudioCallbackData* S = (QP_AudioCallbackData*)data;
+    uint32_t chunk = S->SampleCount*S->OutChannels;
+
+    while(!SDL_AtomicGet(&S->ProducerQuit))
+    {
+        if(ring_writable(&S->Ring) < chunk)
+        {
+            SDL_SemWait(S->ProducerWake);
+            continue;
+        }
+        QP_AudioRender(S,S->RenderOut);
+        ring_write(&S->Ring,S->RenderOut,chunk);
+    }
+    return 0;
+}
+
+void QP_AudioCallback(void* data,Uint8* astream,int len)
+{
+    QP_AudioCallbackData* S = (QP_AudioCallbackData*)data;
+    float* stream = (float*)astream;
+    uint32_t count = len/sizeof(float);
+    uint32_t got = ring_read(&S->Ring,stream,count);
+
+    if(got < count)
+    {
+        memset(stream+got,0,(count-got)*sizeof(float));
+        SDL_AtomicAdd(&S->Underruns,1);
+    }
+
+    SDL_SemPost(S->ProducerWake);
+}
+
+static int QP_AudioStartProducer(QP_AudioCallbackData* S)
+{
+    double ChipRate = DriverGetChipRate(S->Context);
+    int quality = S->Context->Game->Resampler;
+
+    // at least two device buffers are needed to avoid underruns
+    int frames = S->RenderBuffer;
+    if(frames < S->SampleCount*2)
+        frames = S->SampleCount*2;
+
+    // without a resampler, chip frames are repeated or skipped instead
+    S->Resample = 0;
+    S->ResampleBufferPos = S->ResampleBufferLen = 0;
+    if(quality > 0 && fabs(S->SampleRate-ChipRate) >= 0.5)
+    {
+        if(resampler_init(&S->Resampler,ChipRate,S->SampleRate,4,quality))
+            return -1;
+        S->Resample = 1;
+    }
+
+    SDL_AtomicSet(&S->ProducerQuit,0);
+    SDL_AtomicSet(&S->Underruns,0);
+    S->RenderOut = (float*)malloc(S->SampleCount*S->OutChannels*sizeof(float));
+    if(!S->RenderOut || ring_init(&S->Ring,frames*S->OutChannels))
+        return -1;
+
+    S->ProducerWake = SDL_CreateSemaphore(0);
+    if(!S->ProducerWake)
+        return -1;
+
+    S->Producer = SDL_CreateThread(QP_AudioProducer,"QP_AudioProducer",S);
+    if(!S->Producer)
+        return -1;
+    return 0;
+}
+
+static void QP_AudioStopProducer(QP_AudioCallbackData* S)
+{
+    if(S->Producer)
+    {
+        SDL_AtomicSet(&S->ProducerQuit,1);
+        SDL_SemPost(S->ProducerWake);
+        SDL_WaitThread(S->Producer,NULL);
+        S->Producer = NULL;
+    }
+    if(S->ProducerWake)
+        SDL_DestroySemaphore(S->ProducerWake);
+    S->ProducerWake = NULL;
+
+    ring_destroy(&S->Ring);
+    free(S->RenderOut);
+    S->RenderOut = NULL;
+
+    if(S->Resample)
+        resampler_destroy(&S->Resampler);
+    S->Resample = 0;
+}
+
+int QP_AudioInit(QP_Audio* audio,int SampleRate,int SampleCount,int RenderBuffer,int ChannelCount,char *AudioDevice)
 {
     audio->Enabled = 0;
     //audio->state.SampleRate = SampleRate;
     audio->state.ChipUpdate = 0;
-    audio->state.DriverUpdate=0;
+    audio->state.ChipBufferPos = 0;
+    audio->state.ChipBufferLen = 0;
+    memset(audio->state.ChipOut,0,sizeof(audio->state.ChipOut));
     audio->state.MuteRear=0;
-    audio->state.Gain=2.0;
     audio->state.FastForward=0;
-    audio->state.FileLogging=0;
-    audio->state.LogSamples=0;
+    SDL_AtomicSet(&audio->state.FileLogging,0);
+    SDL_AtomicSet(&audio->state.LogBusy,0);
+    audio->state.LogWriter = NULL;
+    audio->state.LogWake = NULL;
+    audio->state.LogIdle = NULL;
+    audio->state.LogOut = NULL;
+    memset(&audio->state.LogRing,0,sizeof(audio->state.LogRing));
+    audio->state.RenderBuffer=RenderBuffer;
 
     SDL_AudioSpec req;
     SDL_zero(req);
@@ -124,6 +265,14 @@ int QP_AudioInit(QP_Audio* audio,int SampleRate,int SampleCount,int ChannelCount
         audio->state.OutChannels = audio->as.channels;
         audio->state.SampleRate = audio->as.freq;
         audio->state.SampleCount = audio->as.samples;
+        if(QP_AudioStartProducer(&audio->state))
+        {
+            printf("Could not start audio thread: %s\n",SDL_GetError());
+            SDL_CloseAudioDevice(audio->dev);
+            QP_AudioStopProducer(&audio->state);
+            audio->Initialized=0;
+            return -1;
+        }
         audio->Initialized=1;
         return 0;
     }
@@ -141,6 +290,7 @@ void QP_AudioClose(QP_Audio* audio)
         return;
     audio->Initialized=0;
     SDL_CloseAudioDevice(audio->dev);
+    QP_AudioStopProducer(&audio->state);
 }
 
 void QP_AudioSetPause(QP_Audio* audio,int pause)
@@ -159,71 +309,181 @@ void QP_AudioTogglePause(QP_Audio* audio)
     SDL_PauseAudioDevice(audio->dev,audio->Enabled);
 }
 
-int QP_AudioWavOpen(QP_Audio* audio, char* filename)
+// Writer thread, writes the log ring to the file in whole blocks. The
+// rest is written and the file is closed when logging stops.
+static int QP_AudioLogWriter(void* data)
 {
-    audio->state.logfile = NULL;
-    audio->state.logfile = fopen(filename,"wb");
-    audio->state.LogSamples=0;
-    audio->state.FileLogging = 0;
-    if(!audio->state.logfile)
-        return -1;
-    audio->state.FileLogging = 1;
+    QP_AudioCallbackData* S = (QP_AudioCallbackData*)data;
+    uint32_t count, block = QPAUDIO_LOG_BLOCK - QPAUDIO_LOG_BLOCK % S->OutChannels;
+    int quit;
 
-    int i;
-    for(i=0;i<58;i++)
+    do
     {
-        putc(0,audio->state.logfile);
+        SDL_SemWait(S->LogWake);
+        quit = SDL_AtomicGet(&S->LogQuit);
+        while(ring_readable(&S->LogRing) >= block || (quit && ring_readable(&S->LogRing)))
+        {
+            count = ring_read(&S->LogRing,S->LogOut,block);
+            wav_write(&S->LogFile,S->LogOut,count/S->OutChannels);
+        }
     }
+    while(!quit);
+    wav_close(&S->LogFile);
+    return 0;
+}
+
+static void QP_AudioStopLogWriter(QP_AudioCallbackData* S)
+{
+    if(S->LogWriter)
+    {
+        SDL_AtomicSet(&S->LogQuit,1);
+        SDL_SemPost(S->LogWake);
+        SDL_WaitThread(S->LogWriter,NULL);
+        S->LogWriter = NULL;
+    }
+    if(S->LogWake)
+        SDL_DestroySemaphore(S->LogWake);
+    S->LogWake = NULL;
+    if(S->LogIdle)
+        SDL_DestroySemaphore(S->LogIdle);
+    S->LogIdle = NULL;
+
+    ring_destroy(&S->LogRing);
+    free(S->LogOut);
+    S->LogOut = NULL;
+}
+
+static int QP_AudioStartLogWriter(QP_AudioCallbackData* S)
+{
+    SDL_AtomicSet(&S->LogQuit,0);
+    SDL_AtomicSet(&S->LogOverflows,0);
+
+    // the ring holds two seconds of audio
+    S->LogOut = (float*)malloc(QPAUDIO_LOG_BLOCK*sizeof(float));
+    if(!S->LogOut || ring_init(&S->LogRing,S->SampleRate*S->OutChannels*2))
+        return -1;
 
+    S->LogWake = SDL_CreateSemaphore(0);
+    S->LogIdle = SDL_CreateSemaphore(0);
+    if(!S->LogWake || !S->LogIdle)
+        return -1;
+
+    S->LogWriter = SDL_CreateThread(QP_AudioLogWriter,"QP_AudioLogWriter",S);
+    if(!S->LogWriter)
+        return -1;
+    return 0;
+}
+
+// Start wav logging. Call from the UI thread.
+int QP_AudioWavOpen(QP_Audio* audio, char* filename)
+{
+    if(SDL_AtomicGet(&audio->state.FileLogging))
+        return 0;
+    // still in the log ring after QP_AudioWavClose timed out
+    if(SDL_AtomicGet(&audio->state.LogBusy) == 2)
+    {
+        printf("wav log: audio thread not responding\n");
+        return -1;
+    }
+    if(wav_open(filename,&audio->state.LogFile,audio->state.OutChannels,audio->state.SampleRate))
+        return -1;
+    if(QP_AudioStartLogWriter(&audio->state))
+    {
+        printf("Could not start wav log thread: %s\n",SDL_GetError());
+        QP_AudioStopLogWriter(&audio->state);
+        wav_close(&audio->state.LogFile);
+        return -1;
+    }
+    SDL_AtomicSet(&audio->state.FileLogging,1);
     return 0;
 }
 
+// Stop wav logging, the writer thread drains the log ring and closes the
+// file. Call from the UI thread.
 void QP_AudioWavClose(QP_Audio* audio)
 {
-    audio->state.FileLogging=0;
-    FILE* f = audio->state.logfile;
-    if(!f)
+    QP_AudioCallbackData* S = &audio->state;
+    int overflows;
+
+    if(!SDL_AtomicGet(&S->FileLogging))
+        return;
+    SDL_AtomicSet(&S->FileLogging,0);
+
+    // the producer may still be queueing a buffer, it posts LogIdle when
+    // done. if it doesn't in time, the writer is stopped but the ring and
+    // semaphores are left to the producer (see QP_AudioWavOpen).
+    if(SDL_AtomicCAS(&S->LogBusy,1,2) &&
+       SDL_SemWaitTimeout(S->LogIdle,QPAUDIO_LOG_CLOSE_TIMEOUT) == SDL_MUTEX_TIMEDOUT)
+    {
+        printf("wav log: audio thread not responding, closing the log anyway\n");
+        SDL_AtomicSet(&S->LogQuit,1);
+        SDL_SemPost(S->LogWake);
+        SDL_WaitThread(S->LogWriter,NULL);
+        S->LogWriter = NULL;
+        free(S->LogOut);
+        S->LogOut = NULL;
         return;
+    }
+    QP_AudioStopLogWriter(S);
+    overflows = SDL_AtomicGet(&S->LogOverflows);
+    if(overflows)
+        printf("wav log: %d frames dropped (disk too slow)\n",overflows);
+}
+
+// Start or stop wav logging, see QP_AudioWavOpen.
+void QP_AudioToggleWavLog(QP_Audio* audio)
+{
+    if(SDL_AtomicGet(&audio->state.FileLogging))
+        QP_AudioWavClose(audio);
+    else
+        QP_AudioWavOpen(audio,"qp_log.wav");
+}
+
+// Initialize sound driver and open the audio device
+int InitGame(QP_Context *ctx)
+{
+    QP_Game *Game = ctx->Game;
+
+    if(InitGameDriver(ctx))
+        return -1;
+
+    char filename[FILENAME_MAX];
+
+    Audio->state.Context = ctx;
+
+    char* audiodev = NULL;
+    if(strlen(Game->AudioDevice))
+        audiodev = Game->AudioDevice;
+
+    int rate = Game->OutputRate > 0 ? Game->OutputRate : DriverGetChipRate(ctx);
+
+    if(QP_AudioInit(Audio,rate,Game->AudioBuffer,Game->RenderBuffer,4,audiodev))
+    {
+        // we couldn't initialize audio with 4 channels, let's try 2 instead...
+        Game->Gain/=2; // you'll thank me for this
+        if(QP_AudioInit(Audio,rate,Game->AudioBuffer,Game->RenderBuffer,2,audiodev))
+            return -1;
+    }
+
+    Audio->state.AutoPlaySong = Game->AutoPlay;
+    Audio->state.MuteRear = Game->MuteRear;
+
+    if(Game->WavLog)
+    {
+        strcpy(filename,"qp_log.wav");
+        if(Game->AutoPlay >= 0)
+        {
+            sprintf(filename,"%s_%03x.wav",Game->Name,Game->AutoPlay&0x7ff);
+        }
+        QP_AudioWavOpen(Audio,filename);
+    }
+
+    return 0;
+}
+
+void DeInitGame(QP_Context *ctx)
+{
+    QP_AudioWavClose(Audio);
 
-    uint32_t a;
-
-    uint32_t c = audio->state.OutChannels;
-    uint32_t b = audio->state.SampleRate;
-    uint32_t d = 4; // bytes per sample
-
-    uint32_t samplecount = audio->state.LogSamples * c;
-    uint32_t chunksize = samplecount * d;
-    uint32_t chunksize2 = chunksize+50;
-
-    fseek(f,0,SEEK_SET);
-    fwrite("RIFF",4,1,f);           // ms id
-    fwrite(&chunksize2,4,1,f);      // file size - 8
-
-    fwrite("WAVE",4,1,f);           // Format id
-
-    fwrite("fmt ",4,1,f);           // chunk id
-    a=18;                           // chunk size
-    fwrite(&a,4,1,f);
-    a=3;                            // audio format (Float)
-    fwrite(&a,2,1,f);
-    fwrite(&c,2,1,f);               // amount of channels
-    fwrite(&b,4,1,f);               // sample rate
-    a=d*c*b;                        // bytes per second
-    fwrite(&a,4,1,f);
-    a=d*c;                          // bytes per sample
-    fwrite(&a,2,1,f);
-    a=d*8;                          // bits per sample
-    fwrite(&a,2,1,f);
-    a=0;                            // extension
-    fwrite(&a,2,1,f);
-
-    fwrite("fact",4,1,f);           // chunk id
-    a=4;                            // chunk size
-    fwrite(&a,4,1,f);
-    fwrite(&samplecount,4,1,f);     // sample count
-
-    fwrite("data",4,1,f);           // chunk id
-    fwrite(&chunksize,4,1,f);       // data size
-
-    fclose(audio->state.logfile);
+    DeInitGameDriver(ctx);
 }
@@ -4,15 +4,32 @@
 #include <stdio.h>
 
 #include "SDL2/SDL_audio.h"
+#include "SDL2/SDL_thread.h"
+#include "SDL2/SDL_mutex.h"
+#include "SDL2/SDL_atomic.h"
+
+#include "loader.h"
+#include "lib/wav.h"
+#include "lib/ring.h"
+#include "lib/resampler.h"
 
 enum {
     QPAUDIO_DRV_PLAY = 1,
     QPAUDIO_CHIP_PLAY = 2,
     QPAUDIO_MUTE = 4,
 };
+
+// chip rate frames rendered at a time
+#define QPAUDIO_CHIP_BUFFER_SIZE 256
+
+// wav log writes, in floats (64 KiB)
+#define QPAUDIO_LOG_BLOCK 16384
+// how long QP_AudioWavClose waits for the producer, in ms
+#define QPAUDIO_LOG_CLOSE_TIMEOUT 1000
+
 typedef struct {
 
-    //Q_State *QDrv;
+    QP_Context *Context;
 
     // temporary home for this variable until i find a better place.
     int AutoPlaySong;
@@ -24,17 +41,49 @@ typedef struct {
     int FastForward;
 
     double ChipUpdate;
-    double DriverUpdate;
 
-    float Gain;
+    // rendered by DriverRender, at the chip rate
+    float ChipBuffer[QPAUDIO_CHIP_BUFFER_SIZE*4];
+    int ChipBufferPos;
+    int ChipBufferLen;
+    float ChipOut[4]; // current frame
+
+    // conversion to the device rate, if it differs from the chip rate
+    int Resample;
+    resampler_t Resampler;
+    float ResampleBuffer[QPAUDIO_CHIP_BUFFER_SIZE*4];
+    int ResampleBufferPos;
+    int ResampleBufferLen;
 
     int MuteRear; // set to mute rear channels (for systems that don't have them)
     int OutChannels; // words per sample
     int SampleCount;
 
-    int FileLogging;
-    FILE* logfile;
-    uint32_t LogSamples;
+    // wav logging. the producer thread queues audio in the log ring,
+    // the writer thread writes it to the file in blocks. the log is
+    // opened and closed on the UI thread, FileLogging is set once the
+    // writer is ready and LogBusy while the producer queues audio (2 if
+    // QP_AudioWavClose is waiting on LogIdle).
+    SDL_atomic_t FileLogging;
+    SDL_atomic_t LogBusy;
+    SDL_sem* LogIdle;
+    wavfile_t LogFile;
+    ring_t LogRing;
+    float* LogOut; // writer buffer, QPAUDIO_LOG_BLOCK floats
+    SDL_Thread* LogWriter;
+    SDL_sem* LogWake;
+    SDL_atomic_t LogQuit;
+    SDL_atomic_t LogOverflows; // frames dropped because the log ring was full
+
+    // render-ahead. the producer thread renders into the ring buffer,
+    // the audio callback only copies from it.
+    ring_t Ring;
+    int RenderBuffer; // ring buffer depth in sample frames
+    float* RenderOut; // producer buffer, SampleCount frames
+    SDL_Thread* Producer;
+    SDL_sem* ProducerWake;
+    SDL_atomic_t ProducerQuit;
+    SDL_atomic_t Underruns;
 
 } QP_AudioCallbackData;
 
@@ -49,11 +98,18 @@ typedef struct {
 
 } QP_Audio;
 
-int  QP_AudioInit(QP_Audio* audio,int SampleRate,int SampleCount,int ChannelCount,char *AudioDevice);
+extern QP_Audio *Audio;
+
+int  QP_AudioInit(QP_Audio* audio,int SampleRate,int SampleCount,int RenderBuffer,int ChannelCount,char *AudioDevice);
 void QP_AudioClose(QP_Audio* audio);
 void QP_AudioSetPause(QP_Audio* audio,int pause);
 void QP_AudioTogglePause(QP_Audio* audio);
 
 int  QP_AudioWavOpen(QP_Audio* audio, char* filename);
 void QP_AudioWavClose(QP_Audio* audio);
+
+void QP_AudioToggleWavLog(QP_Audio* audio);
+
+int  InitGame(QP_Context *ctx);
+void DeInitGame(QP_Context *ctx);
 #endif // AUDIO_H_INCLUDED
@@ -0,0 +1,271 @@
+/*
+    Batch rendering
+
+    Renders every playlist entry of one or more games to separate wav
+    files. Each song is an independent job, jobs are shared by a pool of
+    worker threads that each own a QP_Context. If the song metadata cache
+    has the song lengths, the longest songs of each game are rendered first
+    so a long song does not end up running alone at the end.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "qp.h"
+#include "batch.h"
+#include "lib/thread.h"
+
+typedef struct {
+    char* Name;
+    int SongCount; // -1 until the game has been loaded
+    int Loading;   // a worker is loading the game
+    int NextSong;
+    int Order[256]; // playlist entries in render order
+} QP_BatchGame;
+
+typedef struct {
+    qp_mutex_t Lock;
+
+    QP_Game* Template;
+    QP_BatchOptions* Options;
+
+    int GameCount;
+    QP_BatchGame* Games;
+
+    int Rendered;
+    int Errors;
+} QP_BatchState;
+
+void QP_BatchDefaults(QP_BatchOptions* opt)
+{
+    memset(opt,0,sizeof(*opt));
+    QP_RenderDefaults(&opt->Render);
+    opt->Render.ChipThreads = 0; // the songs are already rendered in parallel
+}
+
+// estimated song length in seconds, for ordering the jobs
+static double batch_song_length(QP_Game* G, int entry)
+{
+    QP_ScanResult* r = QP_CacheFindEntry(G,entry);
+
+    if(!r || !r->ChipRate)
+        return 0;
+    if(r->Status == QP_SCAN_LOOPED)
+        return (r->IntroSamples + 2.0*r->LoopSamples)/r->ChipRate;
+    else if(r->Status == QP_SCAN_ENDED)
+        return r->IntroSamples/r->ChipRate;
+    return QP_CACHE_SCAN_TIME;
+}
+
+// Sort the playlist entries longest first. Called with the game loaded.
+static void batch_sort_songs(QP_BatchGame* g, QP_Game* G)
+{
+    double length[256];
+    int i, j, song;
+
+    for(i=0;i<g->SongCount;i++)
+    {
+        song = i;
+        length[i] = batch_song_length(G,i);
+        for(j=i;j>0 && length[g->Order[j-1]] < length[song];j--)
+            g->Order[j] = g->Order[j-1];
+        g->Order[j] = song;
+    }
+}
+
+// Get the next job. Songs from the already loaded game are preferred,
+// otherwise pick a game that has songs left or has not been loaded yet.
+// Returns the game index, or -1 if there is nothing left to do.
+static int batch_next_job(QP_BatchState* B, int loaded, int* song)
+{
+    int i, pending = -1;
+    *song = -1;
+
+    mutex_lock(&B->Lock);
+    if(loaded >= 0 && B->Games[loaded].NextSong < B->Games[loaded].SongCount)
+    {
+        *song = B->Games[loaded].Order[B->Games[loaded].NextSong++];
+        mutex_unlock(&B->Lock);
+        return loaded;
+    }
+    for(i=0;i<B->GameCount;i++)
+    {
+        QP_BatchGame* g = &B->Games[i];
+        if(g->SongCount < 0 && !g->Loading)
+        {
+            g->Loading = 1;
+            break;
+        }
+        else if(g->SongCount < 0 && pending < 0)
+            pending = i;
+        else if(g->NextSong < g->SongCount)
+        {
+            *song = g->Order[g->NextSong++];
+            break;
+        }
+    }
+    mutex_unlock(&B->Lock);
+
+    // nothing else to do, help out with a game that is still being loaded.
+    if(i == B->GameCount)
+        return pending;
+    return i;
+}
+
+static int batch_worker(void* data)
+{
+    QP_BatchState* B = data;
+    QP_BatchOptions* opt = B->Options;
+    QP_RenderOptions renderopt;
+
+    QP_Context* ctx = QP_ContextCreate();
+    QP_Game* G;
+    int loaded = -1;
+    int id, song;
+
+    if(!ctx)
+        return -1;
+    G = ctx->Game;
+
+    while((id = batch_next_job(B,loaded,&song)) >= 0)
+    {
+        QP_BatchGame* g = &B->Games[id];
+
+        if(id != loaded)
+        {
+            if(loaded >= 0)
+                UnloadGame(ctx);
+            loaded = -1;
+
+            memcpy(G,B->Template,sizeof(QP_Game));
+            strncpy(G->Name,g->Name,sizeof(G->Name)-1);
+            G->ErrorMessage[0] = 0;
+
+            int ret = LoadGame(ctx);
+            if(!ret)
+                QP_CacheLoad(ctx);
+
+            mutex_lock(&B->Lock);
+            if(ret)
+            {
+                if(g->SongCount < 0)
+                {
+                    printf("%s\n",G->ErrorMessage);
+                    g->SongCount = 0;
+                    B->Errors++;
+                }
+            }
+            else
+            {
+                loaded = id;
+                if(g->SongCount < 0)
+                {
+                    g->SongCount = G->SongCount;
+                    batch_sort_songs(g,G);
+                    if(!G->SongCount)
+                        printf("'%s' has no playlist, skipping\n",G->Name);
+                }
+                if(song < 0 && g->NextSong < g->SongCount)
+                    song = g->Order[g->NextSong++];
+            }
+            mutex_unlock(&B->Lock);
+
+            if(ret)
+            {
+                // LoadGame may fail after allocating some of the data
+                UnloadGame(ctx);
+                continue;
+            }
+        }
+
+        if(song < 0)
+            continue;
+
+        renderopt = opt->Render;
+        renderopt.PlaylistEntry = song;
+        int ret = snprintf(renderopt.Filename,FILENAME_MAX,"%s%s%s_%02d_%03x.wav",
+                 opt->OutputPath,
+                 strlen(opt->OutputPath) ? "/" : "",
+                 G->Name,
+                 song+1,
+                 G->Playlist[song].SongID&0x7ff);
+
+        if(ret < 0 || ret >= FILENAME_MAX)
+        {
+            printf("Output filename for '%s' entry %d is too long, skipping\n",G->Name,song+1);
+            ret = -1;
+        }
+        else
+            ret = QP_Render(ctx,&renderopt);
+
+        mutex_lock(&B->Lock);
+        if(ret)
+            B->Errors++;
+        else
+            B->Rendered++;
+        mutex_unlock(&B->Lock);
+    }
+
+    if(loaded >= 0)
+        UnloadGame(ctx);
+    QP_ContextDestroy(ctx);
+    return 0;
+}
+
+// Render all playlist entries for the games in Names. Template holds the
+// global configuration (gain, bootsong, etc) that is copied to each game.
+// Returns the number of songs that could not be rendered.
+int QP_Batch(QP_Game* Template, char** Names, int NameCount, QP_BatchOptions* opt)
+{
+    QP_BatchState B;
+    qp_thread_t* threads;
+    int i, count;
+
+    memset(&B,0,sizeof(B));
+    B.Template = Template;
+    B.Options = opt;
+    B.GameCount = NameCount;
+    B.Games = (QP_BatchGame*)calloc(NameCount,sizeof(QP_BatchGame));
+
+    count = opt->Threads;
+    if(count < 1)
+        count = thread_cpu_count();
+    threads = (qp_thread_t*)malloc(count*sizeof(qp_thread_t));
+
+    if(!B.Games || !threads)
+    {
+        free(B.Games);
+        free(threads);
+        return -1;
+    }
+
+    for(i=0;i<NameCount;i++)
+    {
+        B.Games[i].Name = Names[i];
+        B.Games[i].SongCount = -1;
+    }
+
+    printf("batch rendering %d games using %d threads\n",NameCount,count);
+
+    mutex_init(&B.Lock);
+    for(i=0;i<count;i++)
+    {
+        if(thread_create(&threads[i],batch_worker,&B))
+            break;
+    }
+    if(i == 0)
+    {
+        printf("Could not create worker threads, rendering in main thread\n");
+        batch_worker(&B);
+    }
+    count = i;
+    for(i=0;i<count;i++)
+        thread_join(&threads[i]);
+    mutex_destroy(&B.Lock);
+
+    printf("batch done: %d songs rendered, %d errors\n",B.Rendered,B.Errors);
+
+    free(B.Games);
+    free(threads);
+    return B.Errors;
+}
@@ -0,0 +1,22 @@
+#ifndef BATCH_H_INCLUDED
+#define BATCH_H_INCLUDED
+
+#include <stdio.h>
+
+#include "loader.h"
+#include "render.h"
+
+// Batch rendering options
+typedef struct {
+
+    char OutputPath[FILENAME_MAX]; // output directory, default = current directory
+    int Threads;                   // number of worker threads (0 = number of cores)
+
+    QP_RenderOptions Render;       // filename and playlist entry are ignored
+
+} QP_BatchOptions;
+
+void QP_BatchDefaults(QP_BatchOptions* opt);
+int  QP_Batch(QP_Game* Template, char** Names, int NameCount, QP_BatchOptions* opt);
+
+#endif // BATCH_H_INCLUDED
@@ -0,0 +1,323 @@
+/*
+    Song metadata cache
+
+    Song lengths, loop points and voice usage for the playlist entries of a
+    game, from driver-only scans (see scan.c). The results are saved to a
+    file per game so the songs only need to be scanned once. The file is
+    keyed by a hash of the game ini and ROM data, if any of these change
+    the songs are scanned again.
+
+    Missing songs are scanned by a background thread with its own context,
+    which shares the game data with the player.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#ifdef WIN32
+#include <direct.h>
+#endif
+
+#include "qp.h"
+#include "cache.h"
+#include "lib/ini.h"
+
+char QP_CachePath[128];
+
+// entries are published with a release store of the count
+#define CACHE_LOAD(x) __atomic_load_n(&(x),__ATOMIC_ACQUIRE)
+#define CACHE_STORE(x,v) __atomic_store_n(&(x),(v),__ATOMIC_RELEASE)
+
+static void cache_filename(QP_Game* G, char* filename, int size)
+{
+    char name[256];
+    char *p = G->Name, *s;
+
+    // the name can be a path to the ini file.
+    if((s = strrchr(p,'/')))
+        p = s+1;
+    if((s = strrchr(p,'\\')))
+        p = s+1;
+    snprintf(name,sizeof(name),"%s",p);
+    if((s = strrchr(name,'.')))
+        *s = 0;
+
+    snprintf(filename,size,"%s/%s.cache",QP_CachePath,name);
+}
+
+static QP_CacheEntry* cache_add(QP_Cache* c, int SongID, int Bank)
+{
+    QP_CacheEntry* e;
+    if(c->Count >= QP_CACHE_MAX_SONGS)
+        return NULL;
+    e = &c->Entry[c->Count++];
+    memset(e,0,sizeof(*e));
+    e->SongID = SongID;
+    e->Bank = Bank;
+    return e;
+}
+
+static int cache_read(QP_Cache* c, char* filename)
+{
+    inifile_t ini;
+    QP_CacheEntry* e = NULL;
+    char section[64] = "";
+    uint64_t hash = 0;
+    unsigned int id;
+    int bank, pos;
+
+    if(ini_open(filename,&ini))
+        return -1;
+
+    while(!ini_readnext(&ini))
+    {
+        if(!strcmp(ini.section,"cache"))
+        {
+            if(!strcmp(ini.key,"hash"))
+                hash = strtoull(ini.value,NULL,16);
+            continue;
+        }
+
+        if(strcmp(ini.section,section))
+        {
+            strcpy(section,ini.section);
+            e = NULL;
+            if(sscanf(section,"song.%x.%d",&id,&bank) == 2)
+                e = cache_add(c,id,bank);
+            else if(sscanf(section,"song.%x",&id) == 1)
+                e = cache_add(c,id,-1);
+        }
+        if(!e)
+            continue;
+
+        if(!strcmp(ini.key,"status"))
+            e->Scan.Status = atoi(ini.value);
+        else if(!strcmp(ini.key,"tickrate"))
+            e->Scan.TickRate = atof(ini.value);
+        else if(!strcmp(ini.key,"chiprate"))
+            e->Scan.ChipRate = atof(ini.value);
+        else if(!strcmp(ini.key,"intro"))
+            sscanf(ini.value,"%u %u",&e->Scan.IntroTicks,&e->Scan.IntroSamples);
+        else if(!strcmp(ini.key,"loop"))
+            sscanf(ini.value,"%u %u",&e->Scan.LoopTicks,&e->Scan.LoopSamples);
+        else if(!strcmp(ini.key,"end"))
+            sscanf(ini.value,"%u %u",&e->Scan.EndTicks,&e->Scan.EndSamples);
+        else if(!strcmp(ini.key,"voices"))
+            e->Scan.MaxVoices = atoi(ini.value);
+        else if(sscanf(ini.key,"wave%x",&pos) == 1 && pos < QP_SCAN_MAX_WAVES/32)
+            e->Scan.Waves[pos] = strtoul(ini.value,NULL,16);
+    }
+    ini_close(&ini);
+
+    if(ini.status || hash != c->Hash)
+    {
+        c->Count = 0;
+        return -1;
+    }
+    return 0;
+}
+
+static int cache_write(QP_Game* G, QP_Cache* c, char* filename)
+{
+    FILE* f;
+    QP_ScanResult* r;
+    int i, j;
+
+#ifdef WIN32
+    _mkdir(QP_CachePath);
+#else
+    mkdir(QP_CachePath,0777);
+#endif
+
+    f = fopen(filename,"w");
+    if(!f)
+    {
+        printf("Could not write cache file '%s'\n",filename);
+        return -1;
+    }
+
+    fprintf(f,"; QuattroPlay song cache for '%s'\n",G->Name);
+    fprintf(f,"; This file is generated automatically.\n");
+    fprintf(f,"[cache]\nhash = %016llx\n",(unsigned long long)c->Hash);
+
+    for(i=0;i<c->Count;i++)
+    {
+        r = &c->Entry[i].Scan;
+        if(c->Entry[i].Bank >= 0)
+            fprintf(f,"[song.%03x.%d]\n",c->Entry[i].SongID,c->Entry[i].Bank);
+        else
+            fprintf(f,"[song.%03x]\n",c->Entry[i].SongID);
+        fprintf(f,"status = %d\n",r->Status);
+        fprintf(f,"tickrate = %.17g\n",r->TickRate);
+        fprintf(f,"chiprate = %.17g\n",r->ChipRate);
+        fprintf(f,"intro = %u %u\n",r->IntroTicks,r->IntroSamples);
+        fprintf(f,"loop = %u %u\n",r->LoopTicks,r->LoopSamples);
+        fprintf(f,"end = %u %u\n",r->EndTicks,r->EndSamples);
+        fprintf(f,"voices = %d\n",r->MaxVoices);
+        for(j=0;j<QP_SCAN_MAX_WAVES/32;j++)
+        {
+            if(r->Waves[j])
+                fprintf(f,"wave%x = %08x\n",j,r->Waves[j]);
+        }
+    }
+
+    fclose(f);
+    return 0;
+}
+
+// Load the song metadata cache for the game, the game must be loaded.
+// Missing songs can then be scanned with QP_CacheScan.
+// Does nothing if QP_CachePath is empty.
+int QP_CacheLoad(QP_Context* ctx)
+{
+    QP_Game* G = ctx->Game;
+    QP_Cache* c;
+
+    QP_CacheFree(G);
+    if(!strlen(QP_CachePath))
+        return 0;
+
+    c = (QP_Cache*)malloc(sizeof(QP_Cache));
+    if(!c)
+        return -1;
+    memset(c,0,sizeof(QP_Cache));
+    c->Hash = G->Hash;
+    G->Cache = c;
+
+    cache_filename(G,c->Filename,sizeof(c->Filename));
+    cache_read(c,c->Filename);
+    return 0;
+}
+
+static int cache_scan_thread(void* data)
+{
+    QP_Cache* c = data;
+    QP_Context* ctx = c->ScanContext;
+    QP_Game* G = ctx->Game;
+    QP_CacheEntry* e;
+    int i, scanned = 0;
+
+    for(i=0;i<G->SongCount && !CACHE_LOAD(c->ScanQuit);i++)
+    {
+        QP_PlaylistEntry* p = &G->Playlist[i];
+        if(QP_CacheFind(G,p->SongID,p->Bank))
+            continue;
+        if(c->Count >= QP_CACHE_MAX_SONGS)
+            break;
+
+        e = &c->Entry[c->Count];
+        e->SongID = p->SongID;
+        e->Bank = p->Bank;
+        G->AutoPlay = p->SongID;
+        if(QP_Scan(ctx,p->Bank,QP_CACHE_SCAN_TIME,&e->Scan))
+            break;
+        CACHE_STORE(c->Count,c->Count+1);
+        c->Modified = 1;
+        scanned++;
+    }
+
+    if(c->Modified)
+    {
+        printf("scanned %d songs, updating '%s'\n",scanned,c->Filename);
+        cache_write(G,c,c->Filename);
+        c->Modified = 0;
+    }
+    return 0;
+}
+
+// Start scanning the playlist entries that are missing from the cache in
+// the background. The game must be loaded and the cache loaded with
+// QP_CacheLoad. The scan is stopped by QP_CacheFree.
+int QP_CacheScan(QP_Context* ctx)
+{
+    QP_Game* G = ctx->Game;
+    QP_Cache* c = G->Cache;
+    QP_Context* scan;
+    int i;
+
+    if(!c || c->ScanContext)
+        return 0;
+    for(i=0;i<G->SongCount;i++)
+    {
+        if(!QP_CacheFindEntry(G,i))
+            break;
+    }
+    if(i == G->SongCount)
+        return 0;
+
+    // the scan context shares the game data, but has its own driver
+    scan = QP_ContextCreate();
+    if(!scan)
+        return -1;
+    memcpy(scan->Game,G,sizeof(QP_Game));
+    scan->Game->Cache = c;
+    scan->Game->VgmLog = 0;
+    scan->DriverInterface = (struct QP_DriverInterface*)calloc(1,sizeof(struct QP_DriverInterface));
+    if(!scan->DriverInterface || DriverCreate(scan->DriverInterface,ctx->DriverInterface->Type))
+    {
+        free(scan->DriverInterface);
+        QP_ContextDestroy(scan);
+        return -1;
+    }
+
+    c->ScanQuit = 0;
+    c->ScanContext = scan;
+    if(thread_create(&c->ScanThread,cache_scan_thread,c))
+    {
+        c->ScanContext = NULL;
+        DriverDestroy(scan->DriverInterface);
+        free(scan->DriverInterface);
+        QP_ContextDestroy(scan);
+        return -1;
+    }
+    return 0;
+}
+
+// Stop the scan thread, the song being scanned is finished first.
+static void cache_scan_stop(QP_Cache* c)
+{
+    QP_Context* scan = c->ScanContext;
+    if(!scan)
+        return;
+
+    CACHE_STORE(c->ScanQuit,1);
+    thread_join(&c->ScanThread);
+
+    DriverDestroy(scan->DriverInterface);
+    free(scan->DriverInterface);
+    QP_ContextDestroy(scan);
+    c->ScanContext = NULL;
+}
+
+// Must be called before the game data is freed.
+void QP_CacheFree(QP_Game* G)
+{
+    if(G->Cache)
+        cache_scan_stop(G->Cache);
+    free(G->Cache);
+    G->Cache = NULL;
+}
+
+// Returns NULL if the song is not in the cache.
+QP_ScanResult* QP_CacheFind(QP_Game* G, int SongID, int Bank)
+{
+    QP_Cache* c = G->Cache;
+    int i;
+
+    if(!c)
+        return NULL;
+    for(i=0;i<CACHE_LOAD(c->Count);i++)
+    {
+        if(c->Entry[i].SongID == SongID && c->Entry[i].Bank == Bank)
+            return &c->Entry[i].Scan;
+    }
+    return NULL;
+}
+
+QP_ScanResult* QP_CacheFindEntry(QP_Game* G, int entry)
+{
+    if(entry < 0 || entry >= G->SongCount)
+        return NULL;
+    return QP_CacheFind(G,G->Playlist[entry].SongID,G->Playlist[entry].Bank);
+}
@@ -0,0 +1,48 @@
+/*
+    Song metadata cache
+*/
+#ifndef CACHE_H_INCLUDED
+#define CACHE_H_INCLUDED
+
+#include <stdint.h>
+
+#include "context.h"
+#include "scan.h"
+#include "lib/thread.h"
+
+#define QP_CACHE_MAX_SONGS 256
+
+// time limit for scanning songs that neither loop nor end
+#define QP_CACHE_SCAN_TIME 600.0
+
+typedef struct {
+    int SongID;
+    int Bank; // playlist bank action done before starting the song, -1 = none
+    QP_ScanResult Scan;
+} QP_CacheEntry;
+
+// Scan results for one game. Saved to <QP_CachePath>/<game name>.cache and
+// only reused if the game hash (ini and ROM data) matches.
+// Entries are only added (by the scan thread, see QP_CacheScan) and are
+// complete before Count is increased, so other threads can read them.
+typedef struct QP_Cache {
+    uint64_t Hash;
+    int Modified;
+    int Count;
+    QP_CacheEntry Entry[QP_CACHE_MAX_SONGS];
+
+    QP_Context* ScanContext; // set while the scan thread runs
+    qp_thread_t ScanThread;
+    int ScanQuit;
+    char Filename[512];
+} QP_Cache;
+
+extern char QP_CachePath[128];
+
+int  QP_CacheLoad(QP_Context* ctx);
+int  QP_CacheScan(QP_Context* ctx);
+void QP_CacheFree(struct QP_Game* G);
+QP_ScanResult* QP_CacheFind(struct QP_Game* G, int SongID, int Bank);
+QP_ScanResult* QP_CacheFindEntry(struct QP_Game* G, int entry);
+
+#endif // CACHE_H_INCLUDED
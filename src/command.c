@@ -0,0 +1,85 @@
+/*
+    Driver command queue
+
+    Bounded MPSC queue. Each cell has a sequence number that tells whether
+    it is free for the producer that claimed its position (Seq == pos) or
+    holds a command ready for the consumer (Seq == pos+1).
+*/
+#include <stdint.h>
+
+#include "command.h"
+
+#define CMD_LOAD(x) __atomic_load_n(&(x),__ATOMIC_ACQUIRE)
+#define CMD_STORE(x,v) __atomic_store_n(&(x),(v),__ATOMIC_RELEASE)
+
+// Only safe when no other thread is using the queue.
+void QP_CommandQueueInit(QP_CommandQueue *q)
+{
+    int i;
+    for(i=0;i<QP_COMMAND_QUEUE_SIZE;i++)
+        q->Cell[i].Seq = i;
+    q->PushPos = 0;
+    q->PopPos = 0;
+}
+
+// Add a command to the queue. Returns -1 if the queue is full.
+int QP_CommandPush(QP_CommandQueue *q,QP_Command *cmd)
+{
+    return QP_CommandPushGroup(q,cmd,1);
+}
+
+// Add count commands to the queue, either all or none of them. The
+// consumer sees them at the same time, so commands with the same Tick are
+// run together. Returns -1 if the queue is full.
+int QP_CommandPushGroup(QP_CommandQueue *q,QP_Command *cmd,int count)
+{
+    uint32_t pos = __atomic_load_n(&q->PushPos,__ATOMIC_RELAXED);
+    uint32_t last;
+    int32_t diff;
+    int i;
+
+    if(count < 1 || count > QP_COMMAND_QUEUE_SIZE)
+        return -1;
+
+    while(1)
+    {
+        // cells are freed in order, if the last one is free all of them are
+        last = pos+count-1;
+        diff = (int32_t)(CMD_LOAD(q->Cell[last&(QP_COMMAND_QUEUE_SIZE-1)].Seq) - last);
+        if(diff == 0)
+        {
+            // claim the positions, on failure pos is updated
+            if(__atomic_compare_exchange_n(&q->PushPos,&pos,pos+count,1,__ATOMIC_RELAXED,__ATOMIC_RELAXED))
+                break;
+        }
+        else if(diff < 0)
+            return -1;
+        else
+            pos = __atomic_load_n(&q->PushPos,__ATOMIC_RELAXED);
+    }
+
+    for(i=0;i<count;i++)
+        q->Cell[(pos+i)&(QP_COMMAND_QUEUE_SIZE-1)].Cmd = cmd[i];
+    // publish the first cell last, the consumer stops at it until then
+    for(i=count-1;i>=0;i--)
+        CMD_STORE(q->Cell[(pos+i)&(QP_COMMAND_QUEUE_SIZE-1)].Seq,pos+i+1);
+    return 0;
+}
+
+// Remove the next command if it is due at the specified tick.
+// Returns -1 if the queue is empty or the next command is not due yet.
+int QP_CommandPop(QP_CommandQueue *q,QP_Command *cmd,uint32_t tick)
+{
+    uint32_t pos = q->PopPos;
+    int idx = pos&(QP_COMMAND_QUEUE_SIZE-1);
+
+    if(CMD_LOAD(q->Cell[idx].Seq) != pos+1)
+        return -1;
+    if((int32_t)(q->Cell[idx].Cmd.Tick - tick) > 0)
+        return -1;
+
+    *cmd = q->Cell[idx].Cmd;
+    CMD_STORE(q->Cell[idx].Seq,pos+QP_COMMAND_QUEUE_SIZE);
+    q->PopPos = pos+1;
+    return 0;
+}
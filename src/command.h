@@ -0,0 +1,58 @@
+/*
+    Driver command queue
+*/
+#ifndef COMMAND_H_INCLUDED
+#define COMMAND_H_INCLUDED
+
+#include <stdint.h>
+
+struct QP_Context;
+
+// Must be a power of two.
+#define QP_COMMAND_QUEUE_SIZE 256
+
+enum QP_CommandType {
+    QP_CMD_NONE = 0,
+    QP_CMD_RESET,           // reset driver
+    QP_CMD_UPDATE_TICK,     // run an extra driver tick
+    QP_CMD_SONG_REQUEST,    // Arg1=slot, Arg2=song id
+    QP_CMD_SONG_STOP,       // Arg1=slot
+    QP_CMD_SONG_FADE,       // Arg1=slot
+    QP_CMD_RESET_LOOP_COUNT,
+    QP_CMD_SET_PARAM,       // Arg1=parameter id, Arg2=value
+    QP_CMD_SET_MUTE,        // Arg1=mask
+    QP_CMD_SET_SOLO,        // Arg1=mask
+    QP_CMD_TOGGLE_MUTE,     // Arg1=mask to xor
+    QP_CMD_TOGGLE_SOLO,     // Arg1=mask to xor
+    QP_CMD_GAME_ACTION,     // Arg1=action id
+    QP_CMD_PLAYLIST,        // Arg1=playlist control, Arg2=position (or -1)
+    QP_CMD_CALL,            // call Func(ctx,Data)
+    QP_CMD_SEEK,            // Arg1=tick position, see QP_Seek
+};
+
+typedef struct QP_Command {
+    enum QP_CommandType Type;
+    uint32_t Tick; // run at the first tick boundary where ctx->TickCount >= Tick
+    int Arg1;
+    int Arg2;
+    void (*Func)(struct QP_Context *ctx,void *data);
+    void *Data;
+} QP_Command;
+
+// Lock-free multiple producer, single consumer bounded queue.
+// Any thread may push, only the thread running the driver may pop.
+typedef struct {
+    struct {
+        uint32_t Seq;
+        QP_Command Cmd;
+    } Cell[QP_COMMAND_QUEUE_SIZE];
+    uint32_t PushPos;
+    uint32_t PopPos;
+} QP_CommandQueue;
+
+void QP_CommandQueueInit(QP_CommandQueue *q);
+int  QP_CommandPush(QP_CommandQueue *q,QP_Command *cmd);
+int  QP_CommandPushGroup(QP_CommandQueue *q,QP_Command *cmd,int count);
+int  QP_CommandPop(QP_CommandQueue *q,QP_Command *cmd,uint32_t tick);
+
+#endif // COMMAND_H_INCLUDED
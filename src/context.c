@@ -0,0 +1,39 @@
+/*
+    Player context
+*/
+#include <stdlib.h>
+#include <string.h>
+
+#include "qp.h"
+
+// Allocate a context with an empty game configuration.
+QP_Context* QP_ContextCreate()
+{
+    QP_Context* ctx = (QP_Context*)malloc(sizeof(QP_Context));
+    if(!ctx)
+        return NULL;
+    memset(ctx,0,sizeof(QP_Context));
+    ctx->TickScale = 1.0;
+    QP_CommandQueueInit(&ctx->Commands);
+
+    ctx->Game = (QP_Game*)malloc(sizeof(QP_Game));
+    if(!ctx->Game)
+    {
+        free(ctx);
+        return NULL;
+    }
+    memset(ctx->Game,0,sizeof(QP_Game));
+    ctx->Game->AutoPlay = -1;
+
+    return ctx;
+}
+
+// The game must be unloaded before calling this.
+void QP_ContextDestroy(QP_Context *ctx)
+{
+    if(!ctx)
+        return;
+    QP_SeekDisable(ctx);
+    free(ctx->Game);
+    free(ctx);
+}
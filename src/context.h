@@ -0,0 +1,48 @@
+/*
+    Player context
+*/
+#ifndef CONTEXT_H_INCLUDED
+#define CONTEXT_H_INCLUDED
+
+#include "lib/vgm.h"
+#include "command.h"
+
+struct QP_Game;
+struct QP_DriverInterface;
+struct QP_Keyframes;
+
+// Everything needed to play a game: game configuration and playlist state,
+// the sound driver (which owns the sound chip state) and loggers.
+// Contexts do not share any state, so several can be used at the same time
+// from different threads.
+typedef struct QP_Context {
+
+    struct QP_Game *Game;
+    struct QP_DriverInterface *DriverInterface; // set by LoadGame
+
+    vgmfile_t *Vgm; // set by InitGameDriver if vgm logging is enabled
+
+    // DriverRender state
+    double TickTimer;
+    double TickScale; // driver tick rate multiplier (fast forward), default 1
+
+    // called after each driver tick in DriverRender, with the position of
+    // the next frame. Return nonzero to stop rendering after that frame.
+    int (*TickFunc)(struct QP_Context *ctx,void *data,int pos);
+    void *TickData;
+
+    uint32_t TickCount; // driver ticks since InitGameDriver
+    uint32_t TickSeq; // odd while the driver state is being updated, see DriverReadBegin
+
+    // commands from other threads, run at tick boundaries by DriverRender
+    QP_CommandQueue Commands;
+
+    // driver state snapshots for seeking, NULL = disabled (see QP_SeekEnable)
+    struct QP_Keyframes *Keyframes;
+
+} QP_Context;
+
+QP_Context* QP_ContextCreate();
+void QP_ContextDestroy(QP_Context *ctx);
+
+#endif // CONTEXT_H_INCLUDED
@@ -49,176 +49,536 @@ void DriverDestroy(struct QP_DriverInterface *di)
 }
 
 // Driver initialization
-int DriverInit()
+int DriverInit(QP_Context *ctx)
 {
-    return DriverInterface->IInit(DriverInterface->Driver,Game);
+    return ctx->DriverInterface->IInit(ctx->DriverInterface->Driver,ctx->Game);
 }
-void DriverDeinit()
+void DriverDeinit(QP_Context *ctx)
 {
-    return DriverInterface->IDeinit(DriverInterface->Driver);
+    return ctx->DriverInterface->IDeinit(ctx->DriverInterface->Driver);
 }
 
 // VGM open/close
-void DriverInitVgm() // datablocks
+void DriverInitVgm(QP_Context *ctx) // datablocks
 {
-    return DriverInterface->IVgmOpen(DriverInterface->Driver);
+    return ctx->DriverInterface->IVgmOpen(ctx->DriverInterface->Driver,ctx->Vgm);
 }
-void DriverCloseVgm() // header/clocks
+void DriverCloseVgm(QP_Context *ctx) // header/clocks
 {
-    return DriverInterface->IVgmClose(DriverInterface->Driver);
+    return ctx->DriverInterface->IVgmClose(ctx->DriverInterface->Driver,ctx->Game);
 }
 
 // Driver reset
-void DriverReset(int initial)
+void DriverReset(QP_Context *ctx,int initial)
 {
-    return DriverInterface->IReset(DriverInterface->Driver,Game,initial);
+    return ctx->DriverInterface->IReset(ctx->DriverInterface->Driver,ctx->Game,initial);
 }
 
 // Driver Parameters
-int DriverGetParameterCount()
+int DriverGetParameterCount(QP_Context *ctx)
 {
-    return DriverInterface->IGetParamCnt(DriverInterface->Driver);
+    return ctx->DriverInterface->IGetParamCnt(ctx->DriverInterface->Driver);
 }
-void DriverSetParameter(int id, int value)
+void DriverSetParameter(QP_Context *ctx,int id, int value)
 {
-    return DriverInterface->ISetParam(DriverInterface->Driver,id,value);
+    return ctx->DriverInterface->ISetParam(ctx->DriverInterface->Driver,id,value);
 }
-int DriverGetParameter(int id)
+int DriverGetParameter(QP_Context *ctx,int id)
 {
-    return DriverInterface->IGetParam(DriverInterface->Driver,id);
+    return ctx->DriverInterface->IGetParam(ctx->DriverInterface->Driver,id);
 }
-int DriverGetParameterName(int id,char* buffer,int len)
+int DriverGetParameterName(QP_Context *ctx,int id,char* buffer,int len)
 {
-    return DriverInterface->IGetParamName(DriverInterface->Driver,id,buffer,len);
+    return ctx->DriverInterface->IGetParamName(ctx->DriverInterface->Driver,id,buffer,len);
 }
-char* DriverGetSongMessage()
+char* DriverGetSongMessage(QP_Context *ctx)
 {
-    return DriverInterface->IGetSongMessage(DriverInterface->Driver);
+    return ctx->DriverInterface->IGetSongMessage(ctx->DriverInterface->Driver);
 }
-char* DriverGetDriverInfo()
+char* DriverGetDriverInfo(QP_Context *ctx)
 {
-    return DriverInterface->IGetDriverInfo(DriverInterface->Driver);
+    return ctx->DriverInterface->IGetDriverInfo(ctx->DriverInterface->Driver);
 }
 
 
 // Song requests
-int DriverGetSlotCount()
+int DriverGetSlotCount(QP_Context *ctx)
 {
-    return DriverInterface->IRequestSlotCnt(DriverInterface->Driver);
+    return ctx->DriverInterface->IRequestSlotCnt(ctx->DriverInterface->Driver);
 }
-int DriverGetSongCount(int slot)
+int DriverGetSongCount(QP_Context *ctx,int slot)
 {
-    return DriverInterface->ISongCnt(DriverInterface->Driver,slot);
+    return ctx->DriverInterface->ISongCnt(ctx->DriverInterface->Driver,slot);
 }
-void DriverRequestSong(int slot, int id)
+void DriverRequestSong(QP_Context *ctx,int slot, int id)
 {
-    return DriverInterface->ISongRequest(DriverInterface->Driver,slot,id);
+    return ctx->DriverInterface->ISongRequest(ctx->DriverInterface->Driver,slot,id);
 }
-void DriverStopSong(int slot)
+void DriverStopSong(QP_Context *ctx,int slot)
 {
-    return DriverInterface->ISongStop(DriverInterface->Driver,slot);
+    return ctx->DriverInterface->ISongStop(ctx->DriverInterface->Driver,slot);
 }
-void DriverFadeOutSong(int slot)
+void DriverFadeOutSong(QP_Context *ctx,int slot)
 {
-    return DriverInterface->ISongFade(DriverInterface->Driver,slot);
+    return ctx->DriverInterface->ISongFade(ctx->DriverInterface->Driver,slot);
 }
-int DriverGetSongStatus(int slot)
+int DriverGetSongStatus(QP_Context *ctx,int slot)
 {
-    return DriverInterface->ISongStatus(DriverInterface->Driver,slot);
+    return ctx->DriverInterface->ISongStatus(ctx->DriverInterface->Driver,slot);
 }
-int DriverGetSongId(int slot)
+int DriverGetSongId(QP_Context *ctx,int slot)
 {
-    return DriverInterface->ISongId(DriverInterface->Driver,slot);
+    return ctx->DriverInterface->ISongId(ctx->DriverInterface->Driver,slot);
 }
-double DriverGetPlayingTime(int slot)
+double DriverGetPlayingTime(QP_Context *ctx,int slot)
 {
-    return DriverInterface->ISongTime(DriverInterface->Driver,slot);
+    return ctx->DriverInterface->ISongTime(ctx->DriverInterface->Driver,slot);
 }
 
 // Loop detection
-int DriverGetLoopCount(int slot)
+int DriverGetLoopCount(QP_Context *ctx,int slot)
 {
-    return DriverInterface->IGetLoopCnt(DriverInterface->Driver,slot);
+    return ctx->DriverInterface->IGetLoopCnt(ctx->DriverInterface->Driver,slot);
 }
-void DriverResetLoopCount()
+void DriverResetLoopCount(QP_Context *ctx)
 {
-    return DriverInterface->IResetLoopCnt(DriverInterface->Driver);
+    return ctx->DriverInterface->IResetLoopCnt(ctx->DriverInterface->Driver);
 }
 
 // silence detection - return 1 if all voices are off
 // doesn't actually detect silence, just inactivity
-int DriverDetectSilence()
+int DriverDetectSilence(QP_Context *ctx)
 {
-    return DriverInterface->IDetectSilence(DriverInterface->Driver);
+    return ctx->DriverInterface->IDetectSilence(ctx->DriverInterface->Driver);
 }
 
-double DriverGetTickRate()
+double DriverGetTickRate(QP_Context *ctx)
 {
-    return DriverInterface->ITickRate(DriverInterface->Driver);
+    return ctx->DriverInterface->ITickRate(ctx->DriverInterface->Driver);
 }
-void DriverUpdateTick()
+void DriverUpdateTick(QP_Context *ctx)
 {
-    return DriverInterface->IUpdateTick(DriverInterface->Driver);
+    return ctx->DriverInterface->IUpdateTick(ctx->DriverInterface->Driver);
 }
-double DriverGetChipRate()
+double DriverGetChipRate(QP_Context *ctx)
 {
-    return DriverInterface->IChipRate(DriverInterface->Driver);
+    return ctx->DriverInterface->IChipRate(ctx->DriverInterface->Driver);
 }
-void DriverUpdateChip()
+void DriverUpdateChip(QP_Context *ctx)
 {
-    return DriverInterface->IUpdateChip(DriverInterface->Driver);
+    return ctx->DriverInterface->IUpdateChip(ctx->DriverInterface->Driver);
 }
 // fetch samples
-void DriverSampleChip(float* samples, int samplecnt)
+void DriverSampleChip(QP_Context *ctx,float* samples, int samplecnt)
 {
-    return DriverInterface->ISampleChip(DriverInterface->Driver,samples,samplecnt);
+    return ctx->DriverInterface->ISampleChip(ctx->DriverInterface->Driver,samples,samplecnt);
+}
+
+// Driver state updates, see DriverReadBegin
+static void DriverWriteBegin(QP_Context *ctx)
+{
+    __atomic_store_n(&ctx->TickSeq,ctx->TickSeq+1,__ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+static void DriverWriteEnd(QP_Context *ctx)
+{
+    __atomic_store_n(&ctx->TickSeq,ctx->TickSeq+1,__ATOMIC_RELEASE);
+}
+
+// Render audio at the chip rate with the game gain applied. Driver ticks
+// (including playlist updates) are run between blocks, at the same
+// positions as when updating sample by sample. Returns the number of
+// frames rendered, this is less than requested only if ctx->TickFunc
+// requested a stop. If out is NULL, only the driver is updated (fast scan).
+int DriverRender(QP_Context *ctx,float* out,int frames,int channels)
+{
+    return DriverRenderStems(ctx,out,NULL,frames,channels);
+}
+
+// As DriverRender, but also writes each stem (see DriverGetStemCount) to
+// its own buffer if stems is not NULL.
+int DriverRenderStems(QP_Context *ctx,float* out,float** stems,int frames,int channels)
+{
+    struct QP_DriverInterface *di = ctx->DriverInterface;
+    double delta = ctx->TickScale * di->ITickRate(di->Driver) / di->IChipRate(di->Driver);
+    int i, j, count, pos = 0, tick = 0;
+    int stemcount = stems ? di->IGetStemCount(di->Driver) : 0;
+    float* stemptr[QP_MAX_STEMS];
+    float gain;
+
+    // no ticks while paused, run commands now
+    if(ctx->TickScale == 0)
+    {
+        DriverWriteBegin(ctx);
+        DriverRunCommands(ctx);
+        DriverWriteEnd(ctx);
+    }
+
+    while(pos < frames)
+    {
+        count = 0;
+
+        // run ticks before the frame that triggered them
+        if(tick)
+        {
+            DriverWriteBegin(ctx);
+            while(ctx->TickTimer > 1)
+            {
+                DriverRunCommands(ctx);
+                DriverUpdateTick(ctx);
+                __atomic_store_n(&ctx->TickCount,ctx->TickCount+1,__ATOMIC_RELAXED);
+
+                if(ctx->Vgm)
+                    vgm_delay(ctx->Vgm,441000/DriverGetTickRate(ctx));
+                ctx->TickTimer-=1;
+
+                GameDoUpdate(ctx);
+                QP_SeekRecord(ctx);
+
+                if(ctx->TickFunc && ctx->TickFunc(ctx,ctx->TickData,pos))
+                    frames = pos+1;
+            }
+            DriverWriteEnd(ctx);
+            tick = 0;
+            count = 1;
+        }
+
+        // find the next frame where a tick is needed
+        while(pos+count < frames)
+        {
+            ctx->TickTimer += delta;
+            if(ctx->TickTimer > 1)
+            {
+                tick = 1;
+                break;
+            }
+            count++;
+        }
+
+        if(out && stemcount)
+        {
+            for(j=0;j<stemcount;j++)
+                stemptr[j] = stems[j]+pos*channels;
+            di->IRenderStems(di->Driver,out,stemptr,count,channels);
+
+            gain = GameGetGain(ctx->Game);
+            for(i=0;i<count*channels;i++)
+                out[i] *= gain;
+            for(j=0;j<stemcount;j++)
+                for(i=0;i<count*channels;i++)
+                    stemptr[j][i] *= gain;
+
+            out += count*channels;
+        }
+        else if(out)
+        {
+            di->IRenderBlock(di->Driver,out,count,channels);
+
+            gain = GameGetGain(ctx->Game);
+            for(i=0;i<count*channels;i++)
+                out[i] *= gain;
+
+            out += count*channels;
+        }
+        pos += count;
+    }
+    return pos;
+}
+
+// Render the sound chips on separate threads where the driver supports it.
+// The output is the same, this only helps when rendering offline. Returns
+// 1 if enabled.
+int DriverSetChipThreads(QP_Context *ctx,int enable)
+{
+    struct QP_DriverInterface *di = ctx->DriverInterface;
+    if(!di->ISetChipThreads)
+        return 0;
+    return di->ISetChipThreads(di->Driver,enable);
 }
 
 // get mute/solo masks
-uint32_t DriverGetMute()
+uint32_t DriverGetMute(QP_Context *ctx)
 {
-    return DriverInterface->IGetMute(DriverInterface->Driver);
+    return ctx->DriverInterface->IGetMute(ctx->DriverInterface->Driver);
 }
-void DriverSetMute(uint32_t data)
+void DriverSetMute(QP_Context *ctx,uint32_t data)
 {
-    return DriverInterface->ISetMute(DriverInterface->Driver,data);
+    return ctx->DriverInterface->ISetMute(ctx->DriverInterface->Driver,data);
 }
-uint32_t DriverGetSolo()
+uint32_t DriverGetSolo(QP_Context *ctx)
 {
-    return DriverInterface->IGetSolo(DriverInterface->Driver);
+    return ctx->DriverInterface->IGetSolo(ctx->DriverInterface->Driver);
 }
-void DriverSetSolo(uint32_t data)
+void DriverSetSolo(QP_Context *ctx,uint32_t data)
 {
-    return DriverInterface->ISetSolo(DriverInterface->Driver,data);
+    return ctx->DriverInterface->ISetSolo(ctx->DriverInterface->Driver,data);
 }
 // reset mute and solo masks - convenience function
-void DriverResetMute()
+void DriverResetMute(QP_Context *ctx)
 {
-    DriverSetMute(0);
-    DriverSetSolo(0);
+    DriverSetMute(ctx,0);
+    DriverSetSolo(ctx,0);
 }
 
-void DriverDebugAction(int id)
+void DriverDebugAction(QP_Context *ctx,int id)
 {
-    if(DriverInterface->IDebugAction)
-        return DriverInterface->IDebugAction(DriverInterface->Driver,id);
+    if(ctx->DriverInterface->IDebugAction)
+        return ctx->DriverInterface->IDebugAction(ctx->DriverInterface->Driver,id);
 }
 
-int DriverGetVoiceCount()
+// Stems, see QP_DriverInterface
+int DriverGetStemCount(QP_Context *ctx)
 {
-    if(DriverInterface->IGetVoiceCount)
-        return DriverInterface->IGetVoiceCount(DriverInterface->Driver);
+    struct QP_DriverInterface *di = ctx->DriverInterface;
+    return di->IGetStemCount ? di->IGetStemCount(di->Driver) : 0;
+}
+void DriverGetStemName(QP_Context *ctx,int stem,char* buffer,int len)
+{
+    return ctx->DriverInterface->IGetStemName(ctx->DriverInterface->Driver,stem,buffer,len);
+}
+
+int DriverGetVoiceCount(QP_Context *ctx)
+{
+    if(ctx->DriverInterface->IGetVoiceCount)
+        return ctx->DriverInterface->IGetVoiceCount(ctx->DriverInterface->Driver);
     return 0;
 }
-int DriverGetVoiceInfo(int voice,struct QP_DriverVoiceInfo *dv)
+int DriverGetVoiceInfo(QP_Context *ctx,int voice,struct QP_DriverVoiceInfo *dv)
 {
-    if(DriverInterface->IGetVoiceInfo)
-        return DriverInterface->IGetVoiceInfo(DriverInterface->Driver,voice,dv);
+    if(ctx->DriverInterface->IGetVoiceInfo)
+        return ctx->DriverInterface->IGetVoiceInfo(ctx->DriverInterface->Driver,voice,dv);
     return -1;
 }
-uint16_t DriverGetVoiceStatus(int voice)
+uint16_t DriverGetVoiceStatus(QP_Context *ctx,int voice)
 {
-    if(DriverInterface->IGetVoiceStatus)
-        return DriverInterface->IGetVoiceStatus(DriverInterface->Driver,voice);
+    if(ctx->DriverInterface->IGetVoiceStatus)
+        return ctx->DriverInterface->IGetVoiceStatus(ctx->DriverInterface->Driver,voice);
     return 0;
 }
+
+// Header of the state saved by DriverStateSave, followed by the driver state.
+#define QP_STATE_MAGIC 0x54535051 // "QPST"
+typedef struct {
+    uint32_t Magic;
+    uint32_t DriverType;
+    uint32_t DriverSize;
+
+    // DriverRender position
+    uint32_t TickCount;
+    double TickTimer;
+
+    // playlist state
+    float Fadeout;
+    int PlaylistControl;
+    int PlaylistPosition;
+    int PlaylistScript;
+    int PlaylistSongID;
+    int PlaylistLoop;
+    int QueueSong;
+    int QueueAction;
+    int ActionTimer;
+} QP_StateHeader;
+
+// Save the driver, sound chip and playlist state. Returns the size of the
+// state, nothing is written if buffer is NULL or too small. Call this from
+// the thread that updates the driver (or use DriverPushCall).
+uint32_t DriverStateSave(QP_Context *ctx,uint8_t* buffer,uint32_t size)
+{
+    struct QP_DriverInterface *di = ctx->DriverInterface;
+    QP_Game *G = ctx->Game;
+    QP_StateHeader h;
+
+    if(!di->IStateSave)
+        return 0;
+
+    memset(&h,0,sizeof(h));
+    h.Magic = QP_STATE_MAGIC;
+    h.DriverType = di->Type;
+    h.TickCount = ctx->TickCount;
+    h.TickTimer = ctx->TickTimer;
+    h.Fadeout = G->Fadeout;
+    h.PlaylistControl = G->PlaylistControl;
+    h.PlaylistPosition = G->PlaylistPosition;
+    h.PlaylistScript = G->PlaylistScript;
+    h.PlaylistSongID = G->PlaylistSongID;
+    h.PlaylistLoop = G->PlaylistLoop;
+    h.QueueSong = G->QueueSong;
+    h.QueueAction = G->QueueAction;
+    h.ActionTimer = G->ActionTimer;
+
+    if(!buffer || size < sizeof(h))
+        return sizeof(h) + di->IStateSave(di->Driver,NULL,0);
+
+    h.DriverSize = di->IStateSave(di->Driver,buffer+sizeof(h),size-sizeof(h));
+    memcpy(buffer,&h,sizeof(h));
+    return sizeof(h) + h.DriverSize;
+}
+
+// Load a state saved by DriverStateSave. The game must be loaded and the
+// driver initialized. Mute and solo settings are kept. Call this from the
+// thread that updates the driver, inside DriverRender (from a command) if
+// other threads may be reading the driver state.
+// Returns -1 if the state is invalid or from a different driver.
+int DriverStateLoad(QP_Context *ctx,uint8_t* buffer,uint32_t size)
+{
+    struct QP_DriverInterface *di = ctx->DriverInterface;
+    QP_Game *G = ctx->Game;
+    QP_StateHeader h;
+    int ret;
+
+    if(!di->IStateLoad || size < sizeof(h))
+        return -1;
+    memcpy(&h,buffer,sizeof(h));
+    if(h.Magic != QP_STATE_MAGIC || h.DriverType != di->Type || h.DriverSize > size-sizeof(h))
+        return -1;
+
+    ret = di->IStateLoad(di->Driver,buffer+sizeof(h),h.DriverSize);
+    if(!ret)
+    {
+        __atomic_store_n(&ctx->TickCount,h.TickCount,__ATOMIC_RELAXED);
+        ctx->TickTimer = h.TickTimer;
+        G->Fadeout = h.Fadeout;
+        G->PlaylistControl = h.PlaylistControl;
+        G->PlaylistPosition = h.PlaylistPosition;
+        G->PlaylistScript = h.PlaylistScript;
+        G->PlaylistSongID = h.PlaylistSongID;
+        G->PlaylistLoop = h.PlaylistLoop;
+        G->QueueSong = h.QueueSong;
+        G->QueueAction = h.QueueAction;
+        G->ActionTimer = h.ActionTimer;
+    }
+    return ret;
+}
+
+// Queue a command to be run by the thread that updates the driver.
+// Returns -1 if the queue is full.
+int DriverQueueCommand(QP_Context *ctx,QP_Command *cmd)
+{
+    return QP_CommandPush(&ctx->Commands,cmd);
+}
+// Queue a command to be run at the next tick boundary.
+int DriverPushCommand(QP_Context *ctx,enum QP_CommandType type,int arg1,int arg2)
+{
+    QP_Command cmd = {type,__atomic_load_n(&ctx->TickCount,__ATOMIC_RELAXED),arg1,arg2,NULL,NULL};
+    return QP_CommandPush(&ctx->Commands,&cmd);
+}
+// Queue several commands that are run together at the next tick boundary.
+// Nothing is queued if they don't all fit. cmd[].Tick is set.
+int DriverPushCommands(QP_Context *ctx,QP_Command *cmd,int count)
+{
+    uint32_t tick = __atomic_load_n(&ctx->TickCount,__ATOMIC_RELAXED);
+    int i;
+    for(i=0;i<count;i++)
+        cmd[i].Tick = tick;
+    return QP_CommandPushGroup(&ctx->Commands,cmd,count);
+}
+// Queue a function call to be run at the next tick boundary.
+int DriverPushCall(QP_Context *ctx,void (*func)(QP_Context*,void*),void *data)
+{
+    QP_Command cmd = {QP_CMD_CALL,__atomic_load_n(&ctx->TickCount,__ATOMIC_RELAXED),0,0,func,data};
+    return QP_CommandPush(&ctx->Commands,&cmd);
+}
+
+static void DriverRunCommand(QP_Context *ctx,QP_Command *cmd)
+{
+    QP_Game *G = ctx->Game;
+
+    // keyframes after this point are no longer valid if the song is changed
+    switch(cmd->Type)
+    {
+    case QP_CMD_SET_MUTE:
+    case QP_CMD_SET_SOLO:
+    case QP_CMD_TOGGLE_MUTE:
+    case QP_CMD_TOGGLE_SOLO:
+    case QP_CMD_SEEK:
+        break;
+    default:
+        QP_SeekClear(ctx,ctx->TickCount);
+        break;
+    }
+
+    switch(cmd->Type)
+    {
+    default:
+        break;
+    case QP_CMD_RESET:
+        DriverReset(ctx,0);
+        break;
+    case QP_CMD_UPDATE_TICK:
+        DriverUpdateTick(ctx);
+        break;
+    case QP_CMD_SONG_REQUEST:
+        DriverRequestSong(ctx,cmd->Arg1,cmd->Arg2);
+        break;
+    case QP_CMD_SONG_STOP:
+        DriverStopSong(ctx,cmd->Arg1);
+        break;
+    case QP_CMD_SONG_FADE:
+        DriverFadeOutSong(ctx,cmd->Arg1);
+        break;
+    case QP_CMD_RESET_LOOP_COUNT:
+        DriverResetLoopCount(ctx);
+        break;
+    case QP_CMD_SET_PARAM:
+        DriverSetParameter(ctx,cmd->Arg1,cmd->Arg2);
+        break;
+    case QP_CMD_SET_MUTE:
+        DriverSetMute(ctx,cmd->Arg1);
+        break;
+    case QP_CMD_SET_SOLO:
+        DriverSetSolo(ctx,cmd->Arg1);
+        break;
+    case QP_CMD_TOGGLE_MUTE:
+        DriverSetMute(ctx,DriverGetMute(ctx) ^ (uint32_t)cmd->Arg1);
+        break;
+    case QP_CMD_TOGGLE_SOLO:
+        DriverSetSolo(ctx,DriverGetSolo(ctx) ^ (uint32_t)cmd->Arg1);
+        break;
+    case QP_CMD_GAME_ACTION:
+        GameDoAction(ctx,cmd->Arg1);
+        break;
+    case QP_CMD_PLAYLIST:
+        if(cmd->Arg2 >= 0)
+            G->PlaylistPosition = cmd->Arg2;
+        G->PlaylistControl = cmd->Arg1;
+        break;
+    case QP_CMD_CALL:
+        cmd->Func(ctx,cmd->Data);
+        break;
+    case QP_CMD_SEEK:
+        QP_Seek(ctx,cmd->Arg1);
+        break;
+    }
+}
+
+// Run queued commands that are due. Called by DriverRender at tick
+// boundaries, or directly if the driver is updated some other way.
+void DriverRunCommands(QP_Context *ctx)
+{
+    QP_Command cmd;
+    while(!QP_CommandPop(&ctx->Commands,&cmd,ctx->TickCount))
+        DriverRunCommand(ctx,&cmd);
+}
+
+// Discard all queued commands. The driver must not be running.
+void DriverClearCommands(QP_Context *ctx)
+{
+    QP_Command cmd;
+    while(!QP_CommandPop(&ctx->Commands,&cmd,ctx->TickCount+0x7fffffff))
+        ;
+}
+
+// Reading driver state from another thread without locking:
+//  do { seq = DriverReadBegin(ctx); (copy state) } while(DriverReadRetry(ctx,seq));
+uint32_t DriverReadBegin(QP_Context *ctx)
+{
+    uint32_t seq;
+    while((seq = __atomic_load_n(&ctx->TickSeq,__ATOMIC_ACQUIRE)) & 1)
+        ;
+    return seq;
+}
+int DriverReadRetry(QP_Context *ctx,uint32_t seq)
+{
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&ctx->TickSeq,__ATOMIC_RELAXED) != seq;
+}
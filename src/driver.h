@@ -3,7 +3,9 @@
 
 #include <stdint.h>
 
+#include "context.h"
 #include "loader.h"
+#include "lib/vgm.h"
 
 enum QP_DriverType {
     DRIVER_NOT_LOADED = 0,
@@ -59,6 +61,8 @@ struct QP_DriverVoiceInfo {
     int Pan;
 };
 
+#define QP_MAX_STEMS 64
+
 struct QP_DriverInterface {
     char* Name;
 
@@ -73,8 +77,8 @@ struct QP_DriverInterface {
     // freed by this call
     void (*IDeinit)(void*);
     // Setup vgm logging for this sound driver
-    void (*IVgmOpen)(void*);
-    void (*IVgmClose)(void*);
+    void (*IVgmOpen)(void*,vgmfile_t *vgm);
+    void (*IVgmClose)(void*,QP_Game *game);
     // Reset the sound driver. Initial is set to 1 for the initial setup (right after IInit)
     void (*IReset)(void*,QP_Game *game,int initial);
 
@@ -125,6 +129,19 @@ struct QP_DriverInterface {
     void (*IUpdateChip)(void*);
     // Get samples from the audio
     void (*ISampleChip)(void*,float* samples,int samplecnt);
+    // Run the audio for several ticks, writing interleaved samples to out
+    void (*IRenderBlock)(void*,float* out,int frames,int channels);
+
+    // Stems (separate output for each sound chip voice or channel). Returns
+    // the number of stems, zero if not supported.
+    int (*IGetStemCount)(void*);
+    // Short name for a stem, used in filenames
+    void (*IGetStemName)(void*,int stem,char* buffer,int len);
+    // As IRenderBlock, but also write each stem to stems[stem]
+    void (*IRenderStems)(void*,float* out,float** stems,int frames,int channels);
+    // Render sound chips on worker threads during IRenderBlock, for offline
+    // rendering (optional). Returns 1 if enabled.
+    int (*ISetChipThreads)(void*,int enable);
 
     // Channel mute bitmask
     uint32_t (*IGetMute)(void*);
@@ -138,6 +155,13 @@ struct QP_DriverInterface {
     int (*IGetVoiceCount)(void*);
     int (*IGetVoiceInfo)(void*,int voice,struct QP_DriverVoiceInfo *dv);
     uint16_t (*IGetVoiceStatus)(void*,int voice); // returns less info than the above
+
+    // Save the driver and sound chip state to a blob that can be loaded into
+    // any instance of the same driver with the same game loaded. Returns the
+    // size, nothing is written if the buffer is NULL or too small.
+    uint32_t (*IStateSave)(void*,uint8_t* buffer,uint32_t size);
+    // Load a state saved by IStateSave. Returns -1 if the state is invalid.
+    int (*IStateLoad)(void*,uint8_t* buffer,uint32_t size);
 };
 
 struct QP_DriverTable {
@@ -145,44 +169,59 @@ struct QP_DriverTable {
     char* name;
 };
 
-const struct QP_DriverTable DriverTable[DRIVER_COUNT];
+extern const struct QP_DriverTable DriverTable[DRIVER_COUNT];
 int DriverCreate(struct QP_DriverInterface *di,enum QP_DriverType dt);
 void DriverDestroy(struct QP_DriverInterface *di);
 
-int DriverInit();
-void DriverDeinit();
-void DriverInitVgm();
-void DriverCloseVgm();
-void DriverReset(int initial);
-int DriverGetParameterCount();
-void DriverSetParameter(int id, int value);
-int DriverGetParameter(int id);
-int DriverGetParameterName(int id,char* buffer,int len);
-char* DriverGetSongMessage();
-char* DriverGetDriverInfo();
-int DriverGetSlotCount();
-int DriverGetSongCount(int slot);
-void DriverRequestSong(int slot, int id);
-void DriverStopSong(int slot);
-void DriverFadeOutSong(int slot);
-int DriverGetSongStatus(int slot);
-int DriverGetSongId(int slot);
-double DriverGetPlayingTime(int slot);
-int DriverGetLoopCount(int slot);
-void DriverResetLoopCount();
-int DriverDetectSilence();
-double DriverGetTickRate();
-void DriverUpdateTick();
-double DriverGetChipRate();
-void DriverUpdateChip();
-void DriverSampleChip(float* samples, int samplecnt);
-uint32_t DriverGetMute();
-void DriverSetMute(uint32_t data);
-uint32_t DriverGetSolo();
-void DriverSetSolo(uint32_t data);
-void DriverResetMute();
-void DriverDebugAction(int id);
-int DriverGetVoiceCount();
-int DriverGetVoiceInfo(int voice,struct QP_DriverVoiceInfo *dv);
-uint16_t DriverGetVoiceStatus(int voice);
+int DriverInit(QP_Context *ctx);
+void DriverDeinit(QP_Context *ctx);
+void DriverInitVgm(QP_Context *ctx);
+void DriverCloseVgm(QP_Context *ctx);
+void DriverReset(QP_Context *ctx,int initial);
+int DriverGetParameterCount(QP_Context *ctx);
+void DriverSetParameter(QP_Context *ctx,int id, int value);
+int DriverGetParameter(QP_Context *ctx,int id);
+int DriverGetParameterName(QP_Context *ctx,int id,char* buffer,int len);
+char* DriverGetSongMessage(QP_Context *ctx);
+char* DriverGetDriverInfo(QP_Context *ctx);
+int DriverGetSlotCount(QP_Context *ctx);
+int DriverGetSongCount(QP_Context *ctx,int slot);
+void DriverRequestSong(QP_Context *ctx,int slot, int id);
+void DriverStopSong(QP_Context *ctx,int slot);
+void DriverFadeOutSong(QP_Context *ctx,int slot);
+int DriverGetSongStatus(QP_Context *ctx,int slot);
+int DriverGetSongId(QP_Context *ctx,int slot);
+double DriverGetPlayingTime(QP_Context *ctx,int slot);
+int DriverGetLoopCount(QP_Context *ctx,int slot);
+void DriverResetLoopCount(QP_Context *ctx);
+int DriverDetectSilence(QP_Context *ctx);
+double DriverGetTickRate(QP_Context *ctx);
+void DriverUpdateTick(QP_Context *ctx);
+double DriverGetChipRate(QP_Context *ctx);
+void DriverUpdateChip(QP_Context *ctx);
+void DriverSampleChip(QP_Context *ctx,float* samples, int samplecnt);
+int DriverRender(QP_Context *ctx,float* out,int frames,int channels);
+int DriverRenderStems(QP_Context *ctx,float* out,float** stems,int frames,int channels);
+int DriverSetChipThreads(QP_Context *ctx,int enable);
+uint32_t DriverGetMute(QP_Context *ctx);
+void DriverSetMute(QP_Context *ctx,uint32_t data);
+uint32_t DriverGetSolo(QP_Context *ctx);
+void DriverSetSolo(QP_Context *ctx,uint32_t data);
+void DriverResetMute(QP_Context *ctx);
+void DriverDebugAction(QP_Context *ctx,int id);
+int DriverGetStemCount(QP_Context *ctx);
+void DriverGetStemName(QP_Context *ctx,int stem,char* buffer,int len);
+int DriverGetVoiceCount(QP_Context *ctx);
+int DriverGetVoiceInfo(QP_Context *ctx,int voice,struct QP_DriverVoiceInfo *dv);
+uint16_t DriverGetVoiceStatus(QP_Context *ctx,int voice);
+uint32_t DriverStateSave(QP_Context *ctx,uint8_t* buffer,uint32_t size);
+int DriverStateLoad(QP_Context *ctx,uint8_t* buffer,uint32_t size);
+int DriverQueueCommand(QP_Context *ctx,QP_Command *cmd);
+int DriverPushCommand(QP_Context *ctx,enum QP_CommandType type,int arg1,int arg2);
+int DriverPushCommands(QP_Context *ctx,QP_Command *cmd,int count);
+int DriverPushCall(QP_Context *ctx,void (*func)(QP_Context*,void*),void *data);
+void DriverRunCommands(QP_Context *ctx);
+void DriverClearCommands(QP_Context *ctx);
+uint32_t DriverReadBegin(QP_Context *ctx);
+int DriverReadRetry(QP_Context *ctx,uint32_t seq);
 #endif // DRIVER_H_INCLUDED
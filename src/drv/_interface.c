@@ -6,38 +6,45 @@
 #include "quattro.h"
 #include "helper.h"
 
+#define Q_RENDER_BLOCK 256 // frames per C352_render call
+#define Q_STEM_BLOCK 64
+
 int Q_IInit(void* d,QP_Game *g)
 {
     Q_State *Q = d;
+    C352_cache_disable(&Q->Chip);
     memset(&Q->Chip,0,sizeof(C352));
 
     Q->McuType = Q_GetMcuTypeFromString(g->Type);
     Q->ChipClock = g->ChipFreq;
     C352_init(&Q->Chip,g->ChipFreq);
     Q->Chip.mulaw_type = C352_MULAW_TYPE_C352;
-    Q->Chip.vgm_log = 0;
+    Q->Chip.vgm = NULL;
 
     Q->Chip.wave = g->WaveData;
     Q->Chip.wave_mask = g->WaveMask;
+    C352_cache_enable(&Q->Chip,C352_CACHE_SIZE);
     Q->McuData = g->Data;
     return 0;
 }
 void Q_IDeinit(void* d)
 {
-    Q_Deinit(d);
+    Q_State *Q = d;
+    C352_cache_disable(&Q->Chip);
+    Q_Deinit(Q);
 }
-void Q_IVgmOpen(void* d)
+void Q_IVgmOpen(void* d,vgmfile_t* vgm)
 {
     Q_State *Q = d;
-    vgm_datablock(0x92,0x1000000,Q->Chip.wave,0x1000000,Q->Chip.wave_mask,0);
-    Q->Chip.vgm_log = 1;
+    vgm_datablock(vgm,0x92,0x1000000,Q->Chip.wave,0x1000000,Q->Chip.wave_mask,0);
+    Q->Chip.vgm = vgm;
 }
-void Q_IVgmClose(void* d)
+void Q_IVgmClose(void* d,QP_Game *g)
 {
     Q_State *Q = d;
-    Q->Chip.vgm_log = 0;
-    vgm_poke32(0xdc,Q->ChipClock | Audio->state.MuteRear<<31);
-    vgm_poke8(0xd6,288/4);
+    vgm_poke32(Q->Chip.vgm,0xdc,Q->ChipClock | g->MuteRear<<31);
+    vgm_poke8(Q->Chip.vgm,0xd6,288/4);
+    Q->Chip.vgm = NULL;
 }
 void Q_IReset(void* d,QP_Game* g,int initial)
 {
@@ -173,7 +180,64 @@ void Q_ISampleChip(void* d,float* samples,int samplecnt)
     if(samplecnt > 4)
         samplecnt=4;
     for(i=0;i<samplecnt;i++)
-        samples[i] = Q->Chip.out[i] / (1<<28);
+        samples[i] = (double)Q->Chip.out[i] / (1<<28);
+}
+void Q_IRenderBlock(void* d,float* out,int frames,int channels)
+{
+    Q_State *Q = d;
+    int32_t buffer[Q_RENDER_BLOCK*4];
+    int i, j, count;
+    if(channels > 4)
+        channels=4;
+    while(frames > 0)
+    {
+        count = frames < Q_RENDER_BLOCK ? frames : Q_RENDER_BLOCK;
+        C352_render(&Q->Chip,buffer,count);
+        for(i=0;i<count;i++)
+        {
+            for(j=0;j<channels;j++)
+                out[j] = (double)buffer[i*4+j] / (1<<28);
+            out += channels;
+        }
+        frames -= count;
+    }
+}
+
+// one stem per C352 voice
+int Q_IGetStemCount(void* d)
+{
+    return C352_VOICES;
+}
+void Q_IGetStemName(void* d,int stem,char* buffer,int len)
+{
+    snprintf(buffer,len,"pcm%02d",stem);
+}
+void Q_IRenderStems(void* d,float* out,float** stems,int frames,int channels)
+{
+    Q_State *Q = d;
+    int32_t buffer[Q_STEM_BLOCK*4];
+    int32_t stembuf[C352_VOICES][Q_STEM_BLOCK*4];
+    int32_t *stem[C352_VOICES];
+    int i, j, v, count, pos = 0;
+    if(channels > 4)
+        channels=4;
+    for(v=0;v<C352_VOICES;v++)
+        stem[v] = stembuf[v];
+    while(pos < frames)
+    {
+        count = frames-pos < Q_STEM_BLOCK ? frames-pos : Q_STEM_BLOCK;
+        C352_render_stems(&Q->Chip,buffer,stem,count);
+        for(i=0;i<count;i++)
+        {
+            for(j=0;j<channels;j++)
+            {
+                out[(pos+i)*channels+j] = (double)buffer[i*4+j] / (1<<28);
+                for(v=0;v<C352_VOICES;v++)
+                    stems[v][(pos+i)*channels+j] = (double)stem[v][i*4+j] / (1<<28);
+            }
+        }
+        pos += count;
+    }
 }
 
 uint32_t Q_IGetMute(void* d)
@@ -263,6 +327,14 @@ uint16_t Q_IGetVoiceStatus(void* d,int id)
         v |= 0x80;
     return v;
 }
+uint32_t Q_IStateSave(void* d,uint8_t* buffer,uint32_t size)
+{
+    return Q_StateSave(d,buffer,size);
+}
+int Q_IStateLoad(void* d,uint8_t* buffer,uint32_t size)
+{
+    return Q_StateLoad(d,buffer,size);
+}
 
 struct QP_DriverInterface Q_CreateInterface()
 {
@@ -306,6 +378,11 @@ struct QP_DriverInterface Q_CreateInterface()
         .IChipRate = &Q_IChipRate,
         .IUpdateChip = &Q_IUpdateChip,
         .ISampleChip = &Q_ISampleChip,
+        .IRenderBlock = &Q_IRenderBlock,
+
+        .IGetStemCount = &Q_IGetStemCount,
+        .IGetStemName = &Q_IGetStemName,
+        .IRenderStems = &Q_IRenderStems,
 
         .IGetMute = &Q_IGetMute,
         .ISetMute = &Q_ISetMute,
@@ -314,7 +391,10 @@ struct QP_DriverInterface Q_CreateInterface()
 
         .IGetVoiceCount = &Q_IGetVoiceCount,
         .IGetVoiceInfo = &Q_IGetVoiceInfo,
-        .IGetVoiceStatus = &Q_IGetVoiceStatus
+        .IGetVoiceStatus = &Q_IGetVoiceStatus,
+
+        .IStateSave = &Q_IStateSave,
+        .IStateLoad = &Q_IStateLoad
     };
     return d;
 }
@@ -10,6 +10,8 @@
 #include "tables.h"
 #include "helper.h"
 
+#include "../lib/state.h"
+
 #ifdef DEBUG
 #define DISP_MCU_INFO 1
 #endif
@@ -444,3 +446,113 @@ int8_t Q_LoopDetectionGetCount(Q_State *Q,int TrackNo)
 
 #endif // Q_DISABLE_LOOP_DETECTION
 
+
+// relocate the internal pointers of a state copy, see lib/state.h
+static void Q_StateRelocate(Q_State *Q, Q_State *S, int load)
+{
+    int i, j;
+#define RELOC(_p) (_p) = load ? state_ptr_load(Q,sizeof(*Q),_p) : state_ptr_save(Q,sizeof(*Q),_p)
+    for(i=0;i<Q_MAX_VOICES;i++)
+    {
+        Q_Voice* V = &S->Voice[i];
+        RELOC(S->ActiveChannel[i]);
+        RELOC(V->TrackVol);
+        RELOC(V->PanSource);
+        RELOC(V->EventCh);
+        RELOC(V->Channel);
+        for(j=0;j<8;j++)
+        {
+            RELOC(V->Event[j].Channel);
+            RELOC(V->Event[j].Volume);
+        }
+    }
+    for(i=0;i<Q_MAX_TRACKS;i++)
+    {
+        RELOC(S->Track[i].TempoSource);
+        RELOC(S->Track[i].VolumeSource);
+        for(j=0;j<Q_MAX_TRKCHN;j++)
+        {
+            RELOC(S->Track[i].Channel[j].Voice);
+            RELOC(S->Track[i].Channel[j].Source);
+        }
+    }
+    for(i=0;i<256;i++)
+    {
+        RELOC(S->ChannelPreset[i].Voice);
+        RELOC(S->ChannelPreset[i].Source);
+    }
+#undef RELOC
+}
+
+// Save the driver and C352 state. Returns the size of the state, nothing is
+// written if the buffer is too small.
+uint32_t Q_StateSave(Q_State *Q, uint8_t* buffer, uint32_t size)
+{
+    state_t s;
+    uint32_t structsize = sizeof(Q_State);
+    Q_State *S = (Q_State*)malloc(sizeof(Q_State));
+    if(!S)
+        return 0;
+
+    memcpy(S,Q,sizeof(Q_State));
+    Q_StateRelocate(Q,S,0);
+
+    // pointers to game data and loggers are not part of the state
+    S->McuData = NULL;
+    S->Chip.wave = NULL;
+    S->Chip.cache = NULL;
+    S->Chip.vgm = NULL;
+    S->Chip.mix = NULL;
+#ifndef Q_DISABLE_LOOP_DETECTION
+    S->LoopCounterFlags = NULL;
+#endif
+
+    state_init(&s,buffer,size);
+    state_write(&s,&structsize,sizeof(structsize));
+    state_write(&s,S,sizeof(Q_State));
+#ifndef Q_DISABLE_LOOP_DETECTION
+    state_write_sparse(&s,Q->LoopCounterFlags,0x80000);
+#endif
+    free(S);
+    return s.pos;
+}
+
+// Load a state saved by Q_StateSave. The mute and solo masks are kept.
+// Returns -1 if the state is invalid.
+int Q_StateLoad(Q_State *Q, uint8_t* buffer, uint32_t size)
+{
+    state_t s;
+    uint32_t structsize = 0;
+    Q_State *S = (Q_State*)malloc(sizeof(Q_State));
+    if(!S)
+        return -1;
+
+    state_init(&s,buffer,size);
+    state_read(&s,&structsize,sizeof(structsize));
+    if(structsize == sizeof(Q_State))
+        state_read(&s,S,sizeof(Q_State));
+    if(s.error || structsize != sizeof(Q_State))
+    {
+        free(S);
+        return -1;
+    }
+
+    Q_StateRelocate(Q,S,1);
+    S->McuData = Q->McuData;
+    S->Chip.wave = Q->Chip.wave;
+    S->Chip.cache = Q->Chip.cache;
+    S->Chip.vgm = Q->Chip.vgm;
+    S->Chip.mix = Q->Chip.mix;
+    S->MuteMask = Q->MuteMask;
+    S->SoloMask = Q->SoloMask;
+#ifndef Q_DISABLE_LOOP_DETECTION
+    S->LoopCounterFlags = Q->LoopCounterFlags;
+    state_read_sparse(&s,Q->LoopCounterFlags,0x80000);
+#endif
+
+    if(!s.error)
+        memcpy(Q,S,sizeof(Q_State));
+    free(S);
+    Q_UpdateMuteMask(Q);
+    return s.error ? -1 : 0;
+}
@@ -48,6 +48,10 @@ void Q_WriteChannelInfo(Q_State *Q, int trk, int ch, int index, uint8_t data);
 void Q_WriteMacroInfo(Q_State *Q, int macro, int index, uint8_t data);
 void Q_UpdateMuteMask(Q_State *Q);
 
+// Save/load driver state
+uint32_t Q_StateSave(Q_State *Q, uint8_t* buffer, uint32_t size);
+int Q_StateLoad(Q_State *Q, uint8_t* buffer, uint32_t size);
+
 #ifndef Q_DISABLE_LOOP_DETECTION
 void Q_LoopDetectionInit(Q_State *Q);
 void Q_LoopDetectionFree(Q_State *Q);
@@ -94,7 +94,8 @@ void Q_VoiceProcessEvent(Q_State *Q,int VoiceNo,Q_Voice *V,Q_VoiceEvent *E)
             // no envelope - cutoff
             V->Enabled = 0;
             Q_C352_W(Q,VoiceNo,C352_FLAGS,0);
-            vgm_note_off(VoiceNo);
+            if(Q->Chip.vgm)
+                vgm_note_off(Q->Chip.vgm,VoiceNo);
         }
         return;
     }
@@ -179,7 +180,8 @@ void Q_VoiceKeyOn(Q_State *Q,int VoiceNo,Q_Voice* V)
 
     Q_C352_W(Q,VoiceNo,C352_WAVE_BANK,V->WaveBank);
     Q_C352_W(Q,VoiceNo,C352_FLAGS,    V->WaveFlags|C352_FLG_KEYON);
-    vgm_note_on(VoiceNo,V->BaseNote);
+    if(Q->Chip.vgm)
+        vgm_note_on(Q->Chip.vgm,VoiceNo,V->BaseNote);
 
 }
 
@@ -243,7 +245,8 @@ void Q_VoiceUpdate(Q_State *Q,int VoiceNo,Q_Voice* V)
 void Q_VoiceDisable(Q_State *Q,int VoiceNo,Q_Voice* V)
 {
     Q_C352_W(Q,VoiceNo,C352_FLAGS,0);
-    vgm_note_off(VoiceNo);
+    if(Q->Chip.vgm)
+        vgm_note_off(Q->Chip.vgm,VoiceNo);
     V->EnvState = Q_ENV_DISABLE;
     V->Enabled=0;
 }
@@ -12,19 +12,25 @@
 #include <math.h>
 
 #include "c352.h"
+#include "c352_mix.h"
 #include "../lib/vgm.h"
 
+#define C352_MIX_BLOCK 64 // frames per mixing kernel call
+
 int C352_init(C352 *c, uint32_t clk)
 {
+    c->mix = C352_mix_select();
+
     c->mute_mask=0;
     c->rate = clk/288;
 
     memset(c->v,0,sizeof(C352_Voice)*C352_VOICES);
-    memset(c->out,0,4*sizeof(int16_t));
+    memset(c->out,0,sizeof(c->out));
 
     c->control1 = 0;
     c->control2 = 0;
     c->random = 0x1234;
+    c->active = 0;
 
     C352_set_mulaw_type(c,C352_MULAW_TYPE_C352);
 
@@ -88,16 +94,20 @@ uint16_t C352RegMap[8] = {
 
 void C352_write(C352 *c, uint16_t addr, uint16_t data)
 {
-    if(c->vgm_log)
-        vgm_write(0xe1,0,addr,data);
+    if(c->vgm)
+        vgm_write(c->vgm,0xe1,0,addr,data);
 
     int i;
 
     if(addr < 0x100)
     {
         *(uint16_t*)((void*)&c->v[addr/8]+C352RegMap[addr%8]) = data;
-        if((addr%8) == C352_FLAGS && !(data & C352_FLG_KEYON))
-            vgm_note_off(addr/8);
+        // the drivers only write the busy flag back to voices that are
+        // still playing, a stopped voice is restarted by a key on.
+        if((addr%8) == C352_FLAGS && (data & C352_FLG_BUSY))
+            c->active |= 1u<<(addr/8);
+        if((addr%8) == C352_FLAGS && !(data & C352_FLG_KEYON) && c->vgm)
+            vgm_note_off(c->vgm,addr/8);
     }
     else if(addr == 0x200)
         c->control1 = data;
@@ -115,9 +125,11 @@ void C352_write(C352 *c, uint16_t addr, uint16_t data)
 
                 c->v[i].flags |= C352_FLG_BUSY;
                 c->v[i].flags &= ~(C352_FLG_KEYON|C352_FLG_LOOPHIST);
+                c->active |= 1u<<i;
 
                 c->v[i].latch_flags = c->v[i].flags;
-                vgm_note_from_c352(i,c->v[i].freq);
+                if(c->vgm)
+                    vgm_note_from_c352(c->vgm,i,c->v[i].freq);
 
                 c->v[i].curr_vol[0] = c->v[i].curr_vol[1] = 0;
                 c->v[i].curr_vol[2] = c->v[i].curr_vol[3] = 0;
@@ -125,7 +137,8 @@ void C352_write(C352 *c, uint16_t addr, uint16_t data)
             if(c->v[i].flags & C352_FLG_KEYOFF)
             {
                 c->v[i].flags &= ~(C352_FLG_BUSY|C352_FLG_KEYOFF);
-                vgm_note_off(i);
+                if(c->vgm)
+                    vgm_note_off(c->vgm,i);
                 c->v[i].counter = 0xffff;
             }
         }
@@ -141,9 +154,128 @@ uint16_t C352_read(C352 *c, uint16_t addr)
 }
 
 
-static inline void C352_fetch_sample(C352 *c, int i)
+// Decoded sample cache. Wave data is decoded to 16-bit one page at a time,
+// the first time a voice plays from that page. Pages are kept until the
+// memory limit is reached, then the whole cache is cleared.
+struct C352_WaveCache {
+
+    // decoded from
+    uint8_t* wave;
+    uint32_t wave_mask;
+    int mulaw_type;
+
+    uint32_t page_count;
+    uint32_t used;  // decoded pages
+    uint32_t limit; // max decoded pages
+    int16_t** page[2]; // linear, mulaw
+};
+
+static inline int16_t C352_decode_sample(C352 *c, uint32_t addr, int mulaw)
+{
+    int8_t s = (int8_t)c->wave[addr];
+    return mulaw ? c->mulaw_table[s&0xff] : s<<8;
+}
+
+static void C352_cache_clear(C352_WaveCache *w)
+{
+    uint32_t i;
+    int m;
+
+    for(m=0;m<2;m++)
+    {
+        for(i=0;w->page[m] && i<w->page_count;i++)
+        {
+            free(w->page[m][i]);
+            w->page[m][i] = NULL;
+        }
+    }
+    w->used = 0;
+}
+
+// Enable the decoded sample cache, using up to max_bytes for decoded
+// samples. Returns -1 on failure (samples are then decoded as before).
+int C352_cache_enable(C352 *c, uint32_t max_bytes)
+{
+    C352_cache_disable(c);
+    c->cache = (C352_WaveCache*)calloc(1,sizeof(C352_WaveCache));
+    if(!c->cache)
+        return -1;
+    c->cache->limit = max_bytes / (C352_CACHE_PAGE_SIZE*sizeof(int16_t));
+    if(!c->cache->limit)
+        c->cache->limit = 1;
+    return 0;
+}
+
+void C352_cache_disable(C352 *c)
+{
+    C352_WaveCache *w = c->cache;
+    if(!w)
+        return;
+    C352_cache_clear(w);
+    free(w->page[0]);
+    free(w->page[1]);
+    free(w);
+    c->cache = NULL;
+}
+
+// Clear the cache if the wave data or mulaw type has changed since the
+// pages were decoded.
+static void C352_cache_check(C352 *c)
+{
+    C352_WaveCache *w = c->cache;
+
+    if(w->page[0] && w->wave == c->wave && w->wave_mask == c->wave_mask && w->mulaw_type == c->mulaw_type)
+        return;
+
+    C352_cache_clear(w);
+    free(w->page[0]);
+    free(w->page[1]);
+
+    w->wave = c->wave;
+    w->wave_mask = c->wave_mask;
+    w->mulaw_type = c->mulaw_type;
+    w->page_count = (c->wave_mask/C352_CACHE_PAGE_SIZE)+1;
+    w->page[0] = (int16_t**)calloc(w->page_count,sizeof(int16_t*));
+    w->page[1] = (int16_t**)calloc(w->page_count,sizeof(int16_t*));
+    if(!w->page[0] || !w->page[1])
+    {
+        free(w->page[0]);
+        free(w->page[1]);
+        free(w);
+        c->cache = NULL;
+    }
+}
+
+static int16_t* C352_cache_decode(C352 *c, uint32_t page, int mulaw)
+{
+    C352_WaveCache *w = c->cache;
+    uint32_t i, addr = page*C352_CACHE_PAGE_SIZE;
+    int16_t *p;
+
+    if(w->used >= w->limit)
+        C352_cache_clear(w);
+
+    p = (int16_t*)malloc(C352_CACHE_PAGE_SIZE*sizeof(int16_t));
+    if(!p)
+        return NULL;
+    for(i=0;i<C352_CACHE_PAGE_SIZE;i++)
+        p[i] = C352_decode_sample(c,(addr+i)&c->wave_mask,mulaw);
+
+    w->page[mulaw][page] = p;
+    w->used++;
+    return p;
+}
+
+static inline int16_t C352_cache_fetch(C352 *c, uint32_t addr, int mulaw)
+{
+    int16_t *p = c->cache->page[mulaw][addr/C352_CACHE_PAGE_SIZE];
+    if(!p && !(p = C352_cache_decode(c,addr/C352_CACHE_PAGE_SIZE,mulaw)))
+        return C352_decode_sample(c,addr,mulaw);
+    return p[addr%C352_CACHE_PAGE_SIZE];
+}
+
+static inline void C352_fetch_sample(C352 *c, C352_Voice *v)
 {
-    C352_Voice *v = &c->v[i];
 	v->last_sample = v->sample;
 
     if(~v->flags & C352_FLG_BUSY)
@@ -157,14 +289,10 @@ static inline void C352_fetch_sample(C352 *c, int i)
 	}
 	else
 	{
-		int8_t s;
-
-		s = (int8_t)c->wave[v->pos&c->wave_mask];
-
-		if(v->flags & C352_FLG_MULAW)
-            v->sample = c->mulaw_table[s&0xff];
+		if(c->cache)
+            v->sample = C352_cache_fetch(c,v->pos&c->wave_mask,(v->flags & C352_FLG_MULAW) != 0);
 		else
-			v->sample = s<<8;
+            v->sample = C352_decode_sample(c,v->pos&c->wave_mask,v->flags & C352_FLG_MULAW);
 
 		uint16_t pos = v->pos&0xffff;
 
@@ -205,72 +333,165 @@ static inline void C352_fetch_sample(C352 *c, int i)
 }
 
 
-static inline void C352_update_volume(C352 *c,int i,int ch,uint8_t v)
+static inline int C352_update_volume(C352_Voice *v,int ch,uint8_t vol)
 {
+    uint8_t prev = v->curr_vol[ch];
+
     // disabling filter also disables volume ramp?
-    if(c->v[i].latch_flags & C352_FLG_FILTER)
-        c->v[i].curr_vol[ch] = v;
+    if(v->latch_flags & C352_FLG_FILTER)
+        v->curr_vol[ch] = vol;
 
     // do volume ramping to prevent clicks
-    int16_t vol_delta = c->v[i].curr_vol[ch] - v;
+    int16_t vol_delta = v->curr_vol[ch] - vol;
     if(vol_delta != 0)
-        c->v[i].curr_vol[ch] += (vol_delta>0) ? -1 : 1;
+        v->curr_vol[ch] += (vol_delta>0) ? -1 : 1;
+
+    return v->curr_vol[ch] != prev;
 }
 
-static inline int16_t C352_update_voice(C352 *c, int i)
+// Advance the voice by one sample. Returns nonzero if the volume changed.
+static inline int C352_update_voice(C352 *c, C352_Voice *v)
 {
-    C352_Voice *v = &c->v[i];
-
     uint32_t next_counter = v->counter + v->freq;
+    int changed = 0;
 
 	if(next_counter & 0x10000)
-        C352_fetch_sample(c,i);
+        C352_fetch_sample(c,v);
 
 	if((next_counter^v->counter) & 0x18000)
     {
-        C352_update_volume(c,i,0,c->v[i].vol_f>>8);
-        C352_update_volume(c,i,1,c->v[i].vol_f&0xff);
-        C352_update_volume(c,i,2,c->v[i].vol_r>>8);
-        C352_update_volume(c,i,3,c->v[i].vol_r&0xff);
+        changed |= C352_update_volume(v,0,v->vol_f>>8);
+        changed |= C352_update_volume(v,1,v->vol_f&0xff);
+        changed |= C352_update_volume(v,2,v->vol_r>>8);
+        changed |= C352_update_volume(v,3,v->vol_r&0xff);
     }
 
 	v->counter = next_counter&0xffff;
+    return changed;
+}
 
-	int32_t temp = v->sample;
-	// Interpolate samples
-    if((v->latch_flags & C352_FLG_FILTER) == 0)
-         temp = v->last_sample + (v->counter*(v->sample-v->last_sample)>>16);
+static inline void C352_mix_volume(C352_Voice *v, int32_t *vol)
+{
+    // Left
+    vol[0] = (v->latch_flags & C352_FLG_PHASEFL) ? -v->curr_vol[0] : v->curr_vol[0];
+    vol[2] = (v->latch_flags & C352_FLG_PHASERL) ? -v->curr_vol[2] : v->curr_vol[2];
 
-    return temp;
+    // Right
+    vol[1] = (v->latch_flags & C352_FLG_PHASEFR) ? -v->curr_vol[1] : v->curr_vol[1];
+    vol[3] = (v->latch_flags & C352_FLG_PHASEFR) ? -v->curr_vol[3] : v->curr_vol[3];
 }
 
-void C352_update(C352 *c)
+// Update one voice for a block of samples. The voice is copied to a local
+// so its fields stay in registers for the whole block. The interpolation
+// inputs are collected and passed to the mixing kernel whenever the volume
+// changes or the buffers are full.
+static void C352_render_voice(C352 *c, int i, int32_t *out, int frames)
 {
-    int i;
-    int16_t s;
-    uint16_t flags;
+    C352_Voice v = c->v[i];
+    int mute = c->mute_mask & 1<<i;
+    int filter = v.latch_flags & C352_FLG_FILTER;
+
+    uint16_t counter[C352_MIX_BLOCK];
+    int16_t last[C352_MIX_BLOCK];
+    int16_t sample[C352_MIX_BLOCK];
+    int32_t vol[4];
+    int n, start, count;
+
+    C352_mix_volume(&v,vol);
+
+    while(frames > 0)
+    {
+        count = frames < C352_MIX_BLOCK ? frames : C352_MIX_BLOCK;
+        for(n=start=0;n<count;n++)
+        {
+            if(C352_update_voice(c,&v))
+            {
+                if(!mute)
+                    c->mix(out+start*4,counter+start,last+start,sample+start,n-start,vol);
+                C352_mix_volume(&v,vol);
+                start = n;
+            }
+
+            // no interpolation: s = sample
+            counter[n] = filter ? 0 : v.counter;
+            last[n] = filter ? v.sample : v.last_sample;
+            sample[n] = v.sample;
+        }
+        if(!mute)
+            c->mix(out+start*4,counter+start,last+start,sample+start,count-start,vol);
+
+        out += count*4;
+        frames -= count;
+    }
+    c->v[i] = v;
+
+    // stopped voices drop out once their output has reached zero. the
+    // counter and volume ramp are reset at the next key on.
+    if(!(v.flags & C352_FLG_BUSY) && !v.sample && !v.last_sample)
+        c->active &= ~(1u<<i);
+}
+
+// Render a block of samples to out (4 channels per frame). Only active
+// voices are updated, one at a time over the whole block, except for noise
+// voices which share the random generator and must be updated in voice
+// order.
+// If stems is not NULL, each voice is also written to its own buffer in
+// stems[voice], out is then the sum of the stems.
+void C352_render_stems(C352 *c, int32_t *out, int32_t **stems, int frames)
+{
+    uint32_t active, noise = 0, used = 0;
+    int i, j;
+
+    if(frames <= 0)
+        return;
+
+    if(c->cache)
+        C352_cache_check(c);
 
-    c->out[0]=c->out[1]=c->out[2]=c->out[3]=0;
+    memset(out,0,frames*4*sizeof(*out));
+    if(stems)
+    {
+        for(i=0;i<C352_VOICES;i++)
+            memset(stems[i],0,frames*4*sizeof(*out));
+    }
 
-    for(i=0;i<C352_VOICES;i++)
+    for(active = c->active;active;active &= active-1)
     {
-        s = C352_update_voice(c,i);
+        i = __builtin_ctz(active);
+        used |= 1u<<i;
+        if(c->v[i].flags & C352_FLG_NOISE)
+            noise |= 1u<<i;
+        else
+            C352_render_voice(c,i,stems ? stems[i] : out,frames);
+    }
 
-        if(!(c->mute_mask & 1<<i))
+    for(j=0;noise && j<frames;j++)
+    {
+        for(active = noise;active;active &= active-1)
         {
-            flags = c->v[i].latch_flags;
-
-            // Left
-            c->out[0] += (flags & C352_FLG_PHASEFL) ? -s * (c->v[i].curr_vol[0])
-                                                    :  s * (c->v[i].curr_vol[0]);
-            c->out[2] += (flags & C352_FLG_PHASERL) ? -s * (c->v[i].curr_vol[2])
-                                                    :  s * (c->v[i].curr_vol[2]);
-
-            // Right
-            c->out[1] += (flags & C352_FLG_PHASEFR) ? -s * (c->v[i].curr_vol[1])
-                                                    :  s * (c->v[i].curr_vol[1]);
-            c->out[3] += (flags & C352_FLG_PHASEFR) ? -s * (c->v[i].curr_vol[3])
-                                                    :  s * (c->v[i].curr_vol[3]);
+            i = __builtin_ctz(active);
+            C352_render_voice(c,i,(stems ? stems[i] : out)+j*4,1);
         }
+        noise &= c->active;
     }
+
+    for(active = stems ? used : 0;active;active &= active-1)
+    {
+        int32_t *stem = stems[__builtin_ctz(active)];
+        for(j=0;j<frames*4;j++)
+            out[j] += stem[j];
+    }
+
+    memcpy(c->out,out+(frames-1)*4,sizeof(c->out));
+}
+
+void C352_render(C352 *c, int32_t *out, int frames)
+{
+    C352_render_stems(c,out,NULL,frames);
+}
+
+void C352_update(C352 *c)
+{
+    int32_t out[4];
+    C352_render(c,out,1);
 }
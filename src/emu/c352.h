@@ -9,8 +9,14 @@
 
 #include <stdint.h>
 
+#include "c352_mix.h"
+#include "../lib/vgm.h"
+
 #define C352_VOICES 32
 
+#define C352_CACHE_PAGE_SIZE 4096 // samples per decoded page
+#define C352_CACHE_SIZE (8<<20)   // default decoded sample cache size (bytes)
+
 enum {
     C352_VOL_FRONT  = 0,
     C352_VOL_REAR   = 1,
@@ -72,27 +78,33 @@ typedef struct {
 
 } C352_Voice;
 
+typedef struct C352_WaveCache C352_WaveCache;
+
 typedef struct {
 
     uint32_t rate;
 
     C352_Voice v[C352_VOICES];
-    double out[4];
+    int32_t out[4]; // last rendered frame
 
     uint16_t control1; // unknown purpose for both
     uint16_t control2;
 
     uint8_t* wave;
     uint32_t wave_mask;
+    C352_WaveCache *cache; // decoded samples, NULL = disabled
 
     uint16_t random;
 
+    uint32_t active; // voices that are playing or have not reached silence yet
+    C352_MixFunc mix; // mixing kernel, selected by C352_init
+
     int16_t mulaw_table[256];
 
     // special
     uint32_t mute_mask;
     uint8_t mute_rear;
-    int vgm_log;
+    vgmfile_t *vgm; // set to enable vgm logging
     int mulaw_type;
 
 } C352;
@@ -102,6 +114,12 @@ void C352_set_mulaw_type(C352 *c,int mulaw_type);
 
 // run this at the rate specified in C352_rate (hz)
 void C352_update(C352 *c);
+void C352_render(C352 *c, int32_t *out, int frames);
+void C352_render_stems(C352 *c, int32_t *out, int32_t **stems, int frames);
+
+// optional cache of 16-bit decoded samples
+int C352_cache_enable(C352 *c, uint32_t max_bytes);
+void C352_cache_disable(C352 *c);
 
 void C352_write(C352 *c, uint16_t addr, uint16_t data);
 uint16_t C352_read(C352 *c, uint16_t addr);
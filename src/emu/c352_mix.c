@@ -0,0 +1,165 @@
+/*
+    C352 interpolation and mixing kernels
+
+    The voice state (sample fetch, looping, volume ramps) is updated by
+    C352_render, which collects the interpolation inputs for a run of
+    frames where the volume does not change. The kernels here turn those
+    into output. SIMD versions process several frames per iteration and
+    are selected at runtime, the remaining frames are handled by the
+    scalar version.
+*/
+#include <stdint.h>
+
+#include "c352_mix.h"
+
+#if defined(C352_MIX_X86)
+#include <immintrin.h>
+#elif defined(C352_MIX_NEON)
+#include <arm_neon.h>
+#endif
+
+// The product can overflow 32 bits with noise samples, it is calculated
+// unsigned so the wraparound matches the SIMD multiply.
+static inline int16_t C352_interpolate(uint16_t counter, int16_t last, int16_t sample)
+{
+    return last + ((int32_t)((uint32_t)counter*(uint32_t)(sample-last))>>16);
+}
+
+void C352_mix_c(int32_t* out, const uint16_t* counter, const int16_t* last,
+                const int16_t* sample, int frames, const int32_t* vol)
+{
+    int i;
+    int16_t s;
+
+    for(i=0;i<frames;i++,out+=4)
+    {
+        s = C352_interpolate(counter[i],last[i],sample[i]);
+        out[0] += s*vol[0];
+        out[1] += s*vol[1];
+        out[2] += s*vol[2];
+        out[3] += s*vol[3];
+    }
+}
+
+#if defined(C352_MIX_X86)
+
+// SSE2 has no 32-bit multiply, use the low halves of two 64-bit multiplies.
+__attribute__((target("sse2")))
+static inline __m128i C352_mullo_sse2(__m128i a, __m128i b)
+{
+    __m128i even = _mm_mul_epu32(a,b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_si128(a,4),_mm_srli_si128(b,4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even,_MM_SHUFFLE(0,0,2,0)),
+                              _mm_shuffle_epi32(odd,_MM_SHUFFLE(0,0,2,0)));
+}
+
+// Samples are sign extended to 32 bits, and the volumes are in the low
+// 16 bits of each lane, so _mm_madd_epi16 gives s*vol for each lane.
+#define C352_MIX_FRAME_SSE2(_out,_s,_v,_k) \
+    _mm_storeu_si128((__m128i*)(_out)+(_k), _mm_add_epi32(_mm_loadu_si128((__m128i*)(_out)+(_k)), \
+        _mm_madd_epi16(_mm_shuffle_epi32(_s,_MM_SHUFFLE(_k,_k,_k,_k)),_v)))
+
+__attribute__((target("sse2")))
+void C352_mix_sse2(int32_t* out, const uint16_t* counter, const int16_t* last,
+                   const int16_t* sample, int frames, const int32_t* vol)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v = _mm_setr_epi32(vol[0]&0xffff,vol[1]&0xffff,vol[2]&0xffff,vol[3]&0xffff);
+    __m128i c, a, b, s;
+    int i;
+
+    for(i=0;i+4<=frames;i+=4,out+=16)
+    {
+        c = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)(counter+i)),zero);
+        a = _mm_loadl_epi64((const __m128i*)(last+i));
+        a = _mm_srai_epi32(_mm_unpacklo_epi16(a,a),16);
+        b = _mm_loadl_epi64((const __m128i*)(sample+i));
+        b = _mm_srai_epi32(_mm_unpacklo_epi16(b,b),16);
+
+        s = _mm_add_epi32(a,_mm_srai_epi32(C352_mullo_sse2(c,_mm_sub_epi32(b,a)),16));
+        s = _mm_srai_epi32(_mm_slli_epi32(s,16),16);
+
+        C352_MIX_FRAME_SSE2(out,s,v,0);
+        C352_MIX_FRAME_SSE2(out,s,v,1);
+        C352_MIX_FRAME_SSE2(out,s,v,2);
+        C352_MIX_FRAME_SSE2(out,s,v,3);
+    }
+    C352_mix_c(out,counter+i,last+i,sample+i,frames-i,vol);
+}
+
+__attribute__((target("avx2")))
+void C352_mix_avx2(int32_t* out, const uint16_t* counter, const int16_t* last,
+                   const int16_t* sample, int frames, const int32_t* vol)
+{
+    const __m256i v = _mm256_setr_epi32(vol[0]&0xffff,vol[1]&0xffff,vol[2]&0xffff,vol[3]&0xffff,
+                                        vol[0]&0xffff,vol[1]&0xffff,vol[2]&0xffff,vol[3]&0xffff);
+    const __m256i idx[4] = {
+        _mm256_setr_epi32(0,0,0,0,1,1,1,1),
+        _mm256_setr_epi32(2,2,2,2,3,3,3,3),
+        _mm256_setr_epi32(4,4,4,4,5,5,5,5),
+        _mm256_setr_epi32(6,6,6,6,7,7,7,7),
+    };
+    __m256i c, a, b, s, o;
+    int i, j;
+
+    // 8 frames per iteration, mixed two frames at a time
+    for(i=0;i+8<=frames;i+=8,out+=32)
+    {
+        c = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(counter+i)));
+        a = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(last+i)));
+        b = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(sample+i)));
+
+        s = _mm256_add_epi32(a,_mm256_srai_epi32(_mm256_mullo_epi32(c,_mm256_sub_epi32(b,a)),16));
+        s = _mm256_srai_epi32(_mm256_slli_epi32(s,16),16);
+
+        for(j=0;j<4;j++)
+        {
+            o = _mm256_loadu_si256((__m256i*)out+j);
+            o = _mm256_add_epi32(o,_mm256_madd_epi16(_mm256_permutevar8x32_epi32(s,idx[j]),v));
+            _mm256_storeu_si256((__m256i*)out+j,o);
+        }
+    }
+    C352_mix_c(out,counter+i,last+i,sample+i,frames-i,vol);
+}
+
+#elif defined(C352_MIX_NEON)
+
+void C352_mix_neon(int32_t* out, const uint16_t* counter, const int16_t* last,
+                   const int16_t* sample, int frames, const int32_t* vol)
+{
+    const int32x4_t v = vld1q_s32(vol);
+    int32x4_t c, a, b, s;
+    int i;
+
+    for(i=0;i+4<=frames;i+=4,out+=16)
+    {
+        c = vreinterpretq_s32_u32(vmovl_u16(vld1_u16(counter+i)));
+        a = vmovl_s16(vld1_s16(last+i));
+        b = vmovl_s16(vld1_s16(sample+i));
+
+        s = vaddq_s32(a,vshrq_n_s32(vmulq_s32(c,vsubq_s32(b,a)),16));
+        s = vmovl_s16(vmovn_s32(s));
+
+        vst1q_s32(out+0, vmlaq_s32(vld1q_s32(out+0), v, vdupq_n_s32(vgetq_lane_s32(s,0))));
+        vst1q_s32(out+4, vmlaq_s32(vld1q_s32(out+4), v, vdupq_n_s32(vgetq_lane_s32(s,1))));
+        vst1q_s32(out+8, vmlaq_s32(vld1q_s32(out+8), v, vdupq_n_s32(vgetq_lane_s32(s,2))));
+        vst1q_s32(out+12,vmlaq_s32(vld1q_s32(out+12),v, vdupq_n_s32(vgetq_lane_s32(s,3))));
+    }
+    C352_mix_c(out,counter+i,last+i,sample+i,frames-i,vol);
+}
+
+#endif
+
+C352_MixFunc C352_mix_select()
+{
+#if defined(C352_MIX_X86)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
+        return C352_mix_avx2;
+    if(__builtin_cpu_supports("sse2"))
+        return C352_mix_sse2;
+#elif defined(C352_MIX_NEON)
+    return C352_mix_neon;
+#endif
+    return C352_mix_c;
+}
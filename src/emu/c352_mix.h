@@ -0,0 +1,35 @@
+/*
+    C352 interpolation and mixing kernels
+*/
+#ifndef C352_MIX_H_INCLUDED
+#define C352_MIX_H_INCLUDED
+
+#include <stdint.h>
+
+// Interpolate and mix one voice into a 4 channel buffer. For each frame:
+//      s = (int16_t)(last + (counter*(sample-last) >> 16))
+//      out[ch] += s*vol[ch]
+// vol holds the channel volumes with phase inversion applied.
+// All versions produce identical sums.
+typedef void (*C352_MixFunc)(int32_t* out, const uint16_t* counter, const int16_t* last,
+                             const int16_t* sample, int frames, const int32_t* vol);
+
+void C352_mix_c(int32_t* out, const uint16_t* counter, const int16_t* last,
+                const int16_t* sample, int frames, const int32_t* vol);
+
+#if defined(__x86_64__) || defined(__i386__)
+#define C352_MIX_X86
+void C352_mix_sse2(int32_t* out, const uint16_t* counter, const int16_t* last,
+                   const int16_t* sample, int frames, const int32_t* vol);
+void C352_mix_avx2(int32_t* out, const uint16_t* counter, const int16_t* last,
+                   const int16_t* sample, int frames, const int32_t* vol);
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define C352_MIX_NEON
+void C352_mix_neon(int32_t* out, const uint16_t* counter, const int16_t* last,
+                   const int16_t* sample, int frames, const int32_t* vol);
+#endif
+
+// Pick the fastest kernel supported by the CPU.
+C352_MixFunc C352_mix_select();
+
+#endif // C352_MIX_H_INCLUDED
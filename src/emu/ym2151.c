@@ -11,6 +11,7 @@
 #include <stdio.h>
 
 #include "ym2151.h"
+#include "ym2151_calc.h"
 
 enum {
     YM2151_RATE_STEPS = 8,
@@ -181,81 +182,6 @@ const uint8_t eg_rate_shift[32+64+32] = {    /* Envelope Generator counter shift
 */
 static const uint32_t dt2_tab[4] = { 0, 384, 500, 608 };
 
-/*  DT1 defines offset in Hertz from base note
-*   This table is converted while initialization...
-*   Detune table shown in YM2151 User's Manual is wrong (verified on the real chip)
-*/
-
-static const uint8_t dt1_tab[4*32] = { /* 4*32 DT1 values */
-/* DT1=0 */
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
-/* DT1=1 */
-	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2,
-	2, 3, 3, 3, 4, 4, 4, 5, 5, 6, 6, 7, 8, 8, 8, 8,
-
-/* DT1=2 */
-	1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5,
-	5, 6, 6, 7, 8, 8, 9,10,11,12,13,14,16,16,16,16,
-
-/* DT1=3 */
-	2, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 6, 6, 7,
-	8, 8, 9,10,11,12,13,14,16,17,19,20,22,22,22,22
-};
-
-static const uint16_t phaseinc_rom[768] = {
-	1299,1300,1301,1302,1303,1304,1305,1306,1308,1309,1310,1311,1313,1314,1315,1316,
-	1318,1319,1320,1321,1322,1323,1324,1325,1327,1328,1329,1330,1332,1333,1334,1335,
-	1337,1338,1339,1340,1341,1342,1343,1344,1346,1347,1348,1349,1351,1352,1353,1354,
-	1356,1357,1358,1359,1361,1362,1363,1364,1366,1367,1368,1369,1371,1372,1373,1374,
-	1376,1377,1378,1379,1381,1382,1383,1384,1386,1387,1388,1389,1391,1392,1393,1394,
-	1396,1397,1398,1399,1401,1402,1403,1404,1406,1407,1408,1409,1411,1412,1413,1414,
-	1416,1417,1418,1419,1421,1422,1423,1424,1426,1427,1429,1430,1431,1432,1434,1435,
-	1437,1438,1439,1440,1442,1443,1444,1445,1447,1448,1449,1450,1452,1453,1454,1455,
-	1458,1459,1460,1461,1463,1464,1465,1466,1468,1469,1471,1472,1473,1474,1476,1477,
-	1479,1480,1481,1482,1484,1485,1486,1487,1489,1490,1492,1493,1494,1495,1497,1498,
-	1501,1502,1503,1504,1506,1507,1509,1510,1512,1513,1514,1515,1517,1518,1520,1521,
-	1523,1524,1525,1526,1528,1529,1531,1532,1534,1535,1536,1537,1539,1540,1542,1543,
-	1545,1546,1547,1548,1550,1551,1553,1554,1556,1557,1558,1559,1561,1562,1564,1565,
-	1567,1568,1569,1570,1572,1573,1575,1576,1578,1579,1580,1581,1583,1584,1586,1587,
-	1590,1591,1592,1593,1595,1596,1598,1599,1601,1602,1604,1605,1607,1608,1609,1610,
-	1613,1614,1615,1616,1618,1619,1621,1622,1624,1625,1627,1628,1630,1631,1632,1633,
-	1637,1638,1639,1640,1642,1643,1645,1646,1648,1649,1651,1652,1654,1655,1656,1657,
-	1660,1661,1663,1664,1666,1667,1669,1670,1672,1673,1675,1676,1678,1679,1681,1682,
-	1685,1686,1688,1689,1691,1692,1694,1695,1697,1698,1700,1701,1703,1704,1706,1707,
-	1709,1710,1712,1713,1715,1716,1718,1719,1721,1722,1724,1725,1727,1728,1730,1731,
-	1734,1735,1737,1738,1740,1741,1743,1744,1746,1748,1749,1751,1752,1754,1755,1757,
-	1759,1760,1762,1763,1765,1766,1768,1769,1771,1773,1774,1776,1777,1779,1780,1782,
-	1785,1786,1788,1789,1791,1793,1794,1796,1798,1799,1801,1802,1804,1806,1807,1809,
-	1811,1812,1814,1815,1817,1819,1820,1822,1824,1825,1827,1828,1830,1832,1833,1835,
-	1837,1838,1840,1841,1843,1845,1846,1848,1850,1851,1853,1854,1856,1858,1859,1861,
-	1864,1865,1867,1868,1870,1872,1873,1875,1877,1879,1880,1882,1884,1885,1887,1888,
-	1891,1892,1894,1895,1897,1899,1900,1902,1904,1906,1907,1909,1911,1912,1914,1915,
-	1918,1919,1921,1923,1925,1926,1928,1930,1932,1933,1935,1937,1939,1940,1942,1944,
-	1946,1947,1949,1951,1953,1954,1956,1958,1960,1961,1963,1965,1967,1968,1970,1972,
-	1975,1976,1978,1980,1982,1983,1985,1987,1989,1990,1992,1994,1996,1997,1999,2001,
-	2003,2004,2006,2008,2010,2011,2013,2015,2017,2019,2021,2022,2024,2026,2028,2029,
-	2032,2033,2035,2037,2039,2041,2043,2044,2047,2048,2050,2052,2054,2056,2058,2059,
-	2062,2063,2065,2067,2069,2071,2073,2074,2077,2078,2080,2082,2084,2086,2088,2089,
-	2092,2093,2095,2097,2099,2101,2103,2104,2107,2108,2110,2112,2114,2116,2118,2119,
-	2122,2123,2125,2127,2129,2131,2133,2134,2137,2139,2141,2142,2145,2146,2148,2150,
-	2153,2154,2156,2158,2160,2162,2164,2165,2168,2170,2172,2173,2176,2177,2179,2181,
-	2185,2186,2188,2190,2192,2194,2196,2197,2200,2202,2204,2205,2208,2209,2211,2213,
-	2216,2218,2220,2222,2223,2226,2227,2230,2232,2234,2236,2238,2239,2242,2243,2246,
-	2249,2251,2253,2255,2256,2259,2260,2263,2265,2267,2269,2271,2272,2275,2276,2279,
-	2281,2283,2285,2287,2288,2291,2292,2295,2297,2299,2301,2303,2304,2307,2308,2311,
-	2315,2317,2319,2321,2322,2325,2326,2329,2331,2333,2335,2337,2338,2341,2342,2345,
-	2348,2350,2352,2354,2355,2358,2359,2362,2364,2366,2368,2370,2371,2374,2375,2378,
-	2382,2384,2386,2388,2389,2392,2393,2396,2398,2400,2402,2404,2407,2410,2411,2414,
-	2417,2419,2421,2423,2424,2427,2428,2431,2433,2435,2437,2439,2442,2445,2446,2449,
-	2452,2454,2456,2458,2459,2462,2463,2466,2468,2470,2472,2474,2477,2480,2481,2484,
-	2488,2490,2492,2494,2495,2498,2499,2502,2504,2506,2508,2510,2513,2516,2517,2520,
-	2524,2526,2528,2530,2531,2534,2535,2538,2540,2542,2544,2546,2549,2552,2553,2556,
-	2561,2563,2565,2567,2568,2571,2572,2575,2577,2579,2581,2583,2586,2589,2590,2593
-};
-
-
 /*
     Noise LFO waveform.
 
@@ -296,146 +222,15 @@ static const uint8_t lfo_noise_waveform[256] = {
 	0xE2,0x4D,0x8A,0xA6,0x46,0x95,0x0F,0x8F,0xF5,0x15,0x97,0x32,0xD4,0x28,0x1E,0x55
 };
 
-/*  Frequency-deltas to get the closest frequency possible.
-*   There are 11 octaves because of DT2 (max 950 cents over base frequency)
-*   and LFO phase modulation (max 800 cents below AND over base frequency)
-*   Summary:   octave  explanation
-*              0       note code - LFO PM
-*              1       note code
-*              2       note code
-*              3       note code
-*              4       note code
-*              5       note code
-*              6       note code
-*              7       note code
-*              8       note code
-*              9       note code + DT2 + LFO PM
-*              10      note code + DT2 + LFO PM
-*/
-static uint32_t      freq[11*768];           /* 11 octaves, 768 'cents' per octave */
-
-/*  Frequency deltas for DT1. These deltas alter operator frequency
-*   after it has been taken from frequency-deltas table.
+/*  Lookup tables (frequency-deltas, DT1 deltas, noise periods, TL, sine,
+*   D1L). These were calculated by init_tables() at startup, they are now
+*   generated by ym2151_gentab.c so they can be const and shared between
+*   chip instances.
 */
-static int32_t       dt1_freq[8*32];         /* 8 DT1 levels, 32 KC values */
-
-static uint32_t      noise_tab[32];          /* 17bit Noise Generator periods */
-static int tl_tab[YM2151_TL_TAB_LEN];
-static unsigned int sin_tab[YM2151_SIN_LEN];
-static uint32_t d1l_tab[16];
-
-void init_tables()
-{
-    int i,j;
-    int x;
-	for (x=0; x<YM2151_TL_RES_LEN; x++)
-	{
-		double m = floor(1<<16) / pow(2, (x+1) * (ENV_STEP/4.0) / 8.0);
+#include "ym2151_tables.h"
 
-		/* we never reach (1<<16) here due to the (x+1) */
-		/* result fits within 16 bits at maximum */
-
-		int n = (int)m;     /* 16 bits here */
-		n >>= 4;        /* 12 bits here */
-		if (n&1)        /* round to closest */
-			n = (n>>1)+1;
-		else
-			n = n>>1;
-						/* 11 bits here (rounded) */
-		n <<= 2;        /* 13 bits here (as in real chip) */
-		tl_tab[ x*2 + 0 ] = n;
-		tl_tab[ x*2 + 1 ] = -tl_tab[ x*2 + 0 ];
-
-		for (i=1; i<13; i++)
-		{
-			tl_tab[ x*2+0 + i*2*YM2151_TL_RES_LEN ] =  tl_tab[ x*2+0 ]>>i;
-			tl_tab[ x*2+1 + i*2*YM2151_TL_RES_LEN ] = -tl_tab[ x*2+0 + i*2*YM2151_TL_RES_LEN ];
-		}
-	}
-
-	for (i=0; i<YM2151_SIN_LEN; i++)
-	{
-		/* non-standard sinus */
-		double m = sin( ((i*2)+1) * M_PI / YM2151_SIN_LEN ); /* verified on the real chip */
-
-		/* we never reach zero here due to ((i*2)+1) */
-
-		/* convert to 'decibels' */
-		double o = 8*log(1.0/fabs(m))/log(2.0);
-
-		o = o / (ENV_STEP/4);
-
-		int n = (int)(2.0*o);
-		if (n&1)                        /* round to closest */
-			n = (n>>1)+1;
-		else
-			n = n>>1;
-
-		sin_tab[ i ] = n*2 + (m>=0.0? 0: 1 );
-	}
-
-	/* calculate d1l_tab table */
-	for (i=0; i<16; i++)
-	{
-		d1l_tab[i] = (i!=15 ? i : i+16) * (4.0/ENV_STEP);   /* every 3 'dB' except for all bits = 1 = 45+48 'dB' */
-	}
-
-	/* this loop calculates Hertz values for notes from c-0 to b-7 */
-	/* including 64 'cents' (100/64 that is 1.5625 of real cent) per note */
-	/* i*100/64/1200 is equal to i/768 */
-
-	/* real chip works with 10 bits fixed point values (10.10) */
-
-	for (i=0; i<768; i++)
-	{
-		/* octave 2 - reference octave */
-		freq[ 768+2*768+i ] = (phaseinc_rom[i] << (FREQ_SH - 10)) & 0xffffffc0; /* adjust to X.10 fixed point */
-		/* octave 0 and octave 1 */
-		for (j=0; j<2; j++)
-		{
-			freq[768 + j*768 + i] = (freq[ 768+2*768+i ] >> (2-j) ) & 0xffffffc0; /* adjust to X.10 fixed point */
-		}
-		/* octave 3 to 7 */
-		for (j=3; j<8; j++)
-		{
-			freq[768 + j*768 + i] = freq[ 768+2*768+i ] << (j-2);
-		}
-	}
-
-	/* octave -1 (all equal to: oct 0, _KC_00_, _KF_00_) */
-	for (i=0; i<768; i++)
-	{
-		freq[ 0*768 + i ] = freq[1*768+0];
-	}
-
-	/* octave 8 and 9 (all equal to: oct 7, _KC_14_, _KF_63_) */
-	for (j=8; j<10; j++)
-	{
-		for (i=0; i<768; i++)
-		{
-			freq[768+ j*768 + i ] = freq[768 + 8*768 -1];
-		}
-	}
-
-	for (j=0; j<4; j++)
-	{
-		for (i=0; i<32; i++)
-		{
-			/*calculate phase increment, positive and negative values*/
-			dt1_freq[ (j+0)*32 + i ] = ( dt1_tab[j*32+i] * YM2151_SIN_LEN) >> (20 - FREQ_SH);
-			dt1_freq[ (j+4)*32 + i ] = -dt1_freq[ (j+0)*32 + i ];
-		}
-	}
-
-	/* calculate noise periods table */
-	for (i=0; i<32; i++)
-	{
-		j = (i!=31 ? i : 30);               /* rate 30 and 31 are the same */
-		j = 32-j;
-		j = (65536.0 / (double)(j*32.0));   /* number of samples per one shift of the shift register */
-		noise_tab[i] = j * 64;    /* number of chip clock cycles per one shift */
-	}
-}
+// use the operator kernel when at least this many channels are playing
+#define YM2151_CALC_MIN_CHANNELS 5
 
 
 void YM2151Operator_key_on(YM2151Operator* op,uint32_t key_set, uint32_t eg_cnt)
@@ -471,7 +266,7 @@ void YM2151Operator_key_off(YM2151Operator* op,uint32_t key_set)
 void YM2151_envelope_KONKOFF(YM2151* ym,YM2151Operator * op, int v)
 {
 	// m1, m2, c1, c2
-	static uint8_t masks[4] = { 0x08, 0x20, 0x10, 0x40 };
+	static const uint8_t masks[4] = { 0x08, 0x20, 0x10, 0x40 };
 	int i;
 	for(i=0; i != 4; i++)
 		if (v & masks[i]) /* M1 */
@@ -1105,6 +900,28 @@ void YM2151_chan7_calc(YM2151 *ym)
 }
 
 
+// Evaluate all channels with the operator kernel, same results as calling
+// YM2151_chan_calc for channels 0-6 and YM2151_chan7_calc.
+static void YM2151_lanes_calc(YM2151 *ym)
+{
+	YM2151Operator *op;
+	unsigned int env;
+	uint32_t AM = 0;
+
+	ym->calc(ym, tl_tab, YM2151_TL_TAB_LEN, sin_tab);
+
+	/* noise output of channel 7 */
+	if (ym->noise & 0x80)
+	{
+		op = &ym->oper[7*4];
+		if (op->ams)
+			AM = ym->lfa << (op->ams-1);
+		env = volume_calc(op+3);
+		if (env < 0x3ff)
+			ym->chanout[7] += (ym->noise_rng&0x10000) ? (env ^ 0x3ff) * 2 : -(env ^ 0x3ff) * 2;
+	}
+}
+
 void YM2151_advance_eg(YM2151* ym)
 {
 	YM2151Operator *op;
@@ -1207,68 +1024,77 @@ void YM2151_advance(YM2151 *ym)
 		}
 	}
 
-	i = ym->lfo_phase;
-	/* calculate LFO AM and PM waveform value (all verified on real chip, except for noise algorithm which is impossible to analyse)*/
-	switch (ym->lfo_wsel)
+	/* the waveform is only needed when modulation is enabled */
+	if (!ym->amd && !ym->pmd)
 	{
-	case 0:
-		/* saw */
-		/* AM: 255 down to 0 */
-		/* PM: 0 to 127, -127 to 0 (at PMD=127: LFP = 0 to 126, -126 to 0) */
-		a = 255 - i;
-		if (i<128)
-			p = i;
-		else
-			p = i - 255;
-		break;
-	case 1:
-		/* square */
-		/* AM: 255, 0 */
-		/* PM: 128,-128 (LFP = exactly +PMD, -PMD) */
-		if (i<128)
-		{
-			a = 255;
-			p = 128;
-		}
-		else
+		ym->lfa = 0;
+		ym->lfp = 0;
+	}
+	else
+	{
+		i = ym->lfo_phase;
+		/* calculate LFO AM and PM waveform value (all verified on real chip, except for noise algorithm which is impossible to analyse)*/
+		switch (ym->lfo_wsel)
 		{
-			a = 0;
-			p = -128;
-		}
-		break;
-	case 2:
-		/* triangle */
-		/* AM: 255 down to 1 step -2; 0 up to 254 step +2 */
-		/* PM: 0 to 126 step +2, 127 to 1 step -2, 0 to -126 step -2, -127 to -1 step +2*/
-		if (i<128)
-			a = 255 - (i*2);
-		else
-			a = (i*2) - 256;
-
-		if (i<64)                       /* i = 0..63 */
-			p = i*2;                    /* 0 to 126 step +2 */
-		else if (i<128)                 /* i = 64..127 */
-				p = 255 - i*2;          /* 127 to 1 step -2 */
-			else if (i<192)             /* i = 128..191 */
-					p = 256 - i*2;      /* 0 to -126 step -2*/
-				else                    /* i = 192..255 */
-					p = i*2 - 511;      /*-127 to -1 step +2*/
-		break;
-	case 3:
-	default:    /*keep the compiler happy*/
-		/* random */
-		/* the real algorithm is unknown !!!
-		    We just use a snapshot of data from real chip */
+		case 0:
+			/* saw */
+			/* AM: 255 down to 0 */
+			/* PM: 0 to 127, -127 to 0 (at PMD=127: LFP = 0 to 126, -126 to 0) */
+			a = 255 - i;
+			if (i<128)
+				p = i;
+			else
+				p = i - 255;
+			break;
+		case 1:
+			/* square */
+			/* AM: 255, 0 */
+			/* PM: 128,-128 (LFP = exactly +PMD, -PMD) */
+			if (i<128)
+			{
+				a = 255;
+				p = 128;
+			}
+			else
+			{
+				a = 0;
+				p = -128;
+			}
+			break;
+		case 2:
+			/* triangle */
+			/* AM: 255 down to 1 step -2; 0 up to 254 step +2 */
+			/* PM: 0 to 126 step +2, 127 to 1 step -2, 0 to -126 step -2, -127 to -1 step +2*/
+			if (i<128)
+				a = 255 - (i*2);
+			else
+				a = (i*2) - 256;
+
+			if (i<64)                       /* i = 0..63 */
+				p = i*2;                    /* 0 to 126 step +2 */
+			else if (i<128)                 /* i = 64..127 */
+					p = 255 - i*2;          /* 127 to 1 step -2 */
+				else if (i<192)             /* i = 128..191 */
+						p = 256 - i*2;      /* 0 to -126 step -2*/
+					else                    /* i = 192..255 */
+						p = i*2 - 511;      /*-127 to -1 step +2*/
+			break;
+		case 3:
+		default:    /*keep the compiler happy*/
+			/* random */
+			/* the real algorithm is unknown !!!
+			    We just use a snapshot of data from real chip */
 
-		/* AM: range 0 to 255    */
-		/* PM: range -128 to 127 */
+			/* AM: range 0 to 255    */
+			/* PM: range -128 to 127 */
 
-		a = lfo_noise_waveform[i];
-		p = a-128;
-		break;
+			a = lfo_noise_waveform[i];
+			p = a-128;
+			break;
+		}
+		ym->lfa = a * ym->amd / 128;
+		ym->lfp = p * ym->pmd / 128;
 	}
-	ym->lfa = a * ym->amd / 128;
-	ym->lfp = p * ym->pmd / 128;
 
 
 	/*  The Noise Generator of the YM2151 is 17-bit shift register.
@@ -1374,7 +1200,7 @@ void YM2151_advance(YM2151 *ym)
 
 void YM2151_init(YM2151* ym,int clk)
 {
-	init_tables();
+	ym->calc = YM2151_calc_select();
     ym->rate = clk/64;
 
 	//m_stream = stream_alloc(0, 2, clock() / 64);
@@ -1449,53 +1275,105 @@ void YM2151_reset(YM2151* ym)
 	}
 
     ym->out[0] = ym->out[1] = ym->out[2] = ym->out[3] = 0;
+    memset(ym->stem_out,0,sizeof(ym->stem_out));
 }
 
 
-void YM2151_update(YM2151* ym)
+// A channel is silent once all operators are off and the feedback and
+// delayed sample values have cleared, YM2151_chan_calc then only outputs
+// zero (the noise output on channel 7 is also zero with C2 off).
+static uint32_t YM2151_active_channels(YM2151* ym)
 {
-    YM2151_advance_eg(ym);
-
+    YM2151Operator *op = ym->oper;
+    uint32_t mask = 0;
     int ch;
-    for(ch=0; ch<8; ch++)
-        ym->chanout[ch] = 0;
-
-    for(ch=0; ch<7; ch++)
-        YM2151_chan_calc(ym,ch);
-    YM2151_chan7_calc(ym);
-
-    int outl = 0;
-    int outr = 0;
-    int32_t out = 0;
-    for(ch=0; ch<8; ch++) {
-        if(!(ym->mute_mask & 1<<ch))
+
+    for(ch=0; ch<8; ch++, op+=4)
+    {
+        if(op[0].state != EG_OFF || op[1].state != EG_OFF ||
+           op[2].state != EG_OFF || op[3].state != EG_OFF ||
+           op->fb_out_curr || op->fb_out_prev || op->mem_value)
+            mask |= 1<<ch;
+    }
+    return mask;
+}
+
+// Render frames to a stereo buffer (or only update the chip if out is NULL).
+// ym->out and ym->stem_out hold the last two frames afterwards.
+void YM2151_render(YM2151* ym, int32_t* out, int frames)
+{
+    uint32_t active, mask;
+    int32_t chout;
+    int i, ch, outl, outr;
+
+    for(i=0; i<frames; i++)
+    {
+        YM2151_advance_eg(ym);
+
+        active = YM2151_active_channels(ym);
+        for(ch=0; ch<8; ch++)
+            ym->chanout[ch] = 0;
+        // the kernel always evaluates all channels
+        if(ym->calc && __builtin_popcount(active) >= YM2151_CALC_MIN_CHANNELS)
+            YM2151_lanes_calc(ym);
+        else
         {
-            out = ym->chanout[ch];
-            if(out > 16383 || out < -16384)
-                out = 16383^(out>>31);
-            outl += out & ym->pan[2*ch];
-            outr += out & ym->pan[2*ch+1];
+            for(mask=active & 0x7f; mask; mask &= mask-1)
+                YM2151_chan_calc(ym,__builtin_ctz(mask));
+            if(active & 0x80)
+                YM2151_chan7_calc(ym);
         }
-    }
 
-    if (outl > 32767)
-        outl = 32767;
-    else if (outl < -32768)
-        outl = -32768;
-    if (outr > 32767)
-        outr = 32767;
-    else if (outr < -32768)
-        outr = -32768;
+        outl = 0;
+        outr = 0;
+        for(mask=active & ~ym->mute_mask; mask; mask &= mask-1)
+        {
+            ch = __builtin_ctz(mask);
+            chout = ym->chanout[ch];
+            if(chout > 16383 || chout < -16384)
+                chout = 16383^(chout>>31);
+            ym->chanout[ch] = chout;
+            outl += chout & ym->pan[2*ch];
+            outr += chout & ym->pan[2*ch+1];
+        }
 
-    // last samples, used for interpolation
-    ym->out[2] = ym->out[0];
-    ym->out[3] = ym->out[1];
+        if(ym->stems)
+        {
+            for(ch=0; ch<8; ch++)
+            {
+                chout = (ym->mute_mask & 1<<ch) ? 0 : ym->chanout[ch];
+                ym->stem_out[ch][2] = ym->stem_out[ch][0];
+                ym->stem_out[ch][3] = ym->stem_out[ch][1];
+                ym->stem_out[ch][0] = (int32_t)(chout & ym->pan[2*ch])/32768.0;
+                ym->stem_out[ch][1] = (int32_t)(chout & ym->pan[2*ch+1])/32768.0;
+            }
+        }
 
-    //printf("%d %d\n",outl,outr);
-    ym->out[0] = outl/32768.0;
-    ym->out[1] = outr/32768.0;
+        if (outl > 32767)
+            outl = 32767;
+        else if (outl < -32768)
+            outl = -32768;
+        if (outr > 32767)
+            outr = 32767;
+        else if (outr < -32768)
+            outr = -32768;
+
+        // last samples, used for interpolation
+        ym->out[2] = ym->out[0];
+        ym->out[3] = ym->out[1];
+        ym->out[0] = outl/32768.0;
+        ym->out[1] = outr/32768.0;
+        if(out)
+        {
+            *out++ = outl;
+            *out++ = outr;
+        }
 
-    YM2151_advance(ym);
+        YM2151_advance(ym);
+    }
 }
 
-
+void YM2151_update(YM2151* ym)
+{
+    YM2151_render(ym,NULL,1);
+}
@@ -64,6 +64,14 @@ enum {
 typedef struct YM2151Operator YM2151Operator;
 typedef struct YM2151 YM2151;
 
+// Operator kernel (see ym2151_calc.h). Evaluates the operators of all 8
+// channels for one sample and writes the results to ym->chanout, with the
+// same results as YM2151_chan_calc and YM2151_chan7_calc. If noise is
+// enabled, the C2 output of channel 7 is left out and must be added by
+// the caller.
+typedef void (*YM2151_CalcFunc)(YM2151* ym, const int* tl_tab, int tl_len,
+                                const unsigned int* sin_tab);
+
 /* struct describing a single operator */
 struct YM2151Operator
 {
@@ -168,11 +176,15 @@ struct YM2151
     uint32_t mute_mask;
     double out[4];
 
+    int stems;              // set to keep the output of each channel below
+    double stem_out[8][4];  // left, right, last left, last right
+
     int rate;
 
+    YM2151_CalcFunc calc;   // operator kernel, NULL = YM2151_chan_calc
+
 };
 
-void YM2151_init_tables(YM2151* ym);
 void YM2151_envelope_KONKOFF(YM2151* ym,YM2151Operator * op, int v);
 void YM2151_set_connect(YM2151* ym,YM2151Operator *om1, int cha, int v);
 void YM2151_advance(YM2151* ym);
@@ -190,5 +202,6 @@ void YM2151Operator_key_off(struct YM2151Operator *op,uint32_t key_set);
 void YM2151_init(YM2151* ym,int clk);
 void YM2151_reset(YM2151* ym);
 void YM2151_update(YM2151* ym);
+void YM2151_render(YM2151* ym, int32_t* out, int frames);
 
 #endif // YM2151_H_INCLUDED
@@ -0,0 +1,148 @@
+/*
+    YM2151 operator kernels
+
+    YM2151_chan_calc evaluates one channel at a time and routes operator
+    outputs through the connect/mem_connect pointers. The kernels here
+    evaluate the same operator slot of all 8 channels at once, with the
+    routing of each connection algorithm turned into lane masks.
+    Envelope and phase generation are still done by ym2151.c.
+*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ym2151_calc.h"
+
+#if defined(YM2151_CALC_X86)
+#include <immintrin.h>
+
+// Routing of each algorithm, see YM2151_set_connect.
+enum {
+    ROUTE_MEMV_M2   = 0x001, // delayed sample restored to M2 input
+    ROUTE_MEMV_C2   = 0x002, // ... to C2 input
+    ROUTE_MEMV_MEM  = 0x004, // ... to MEM (not used)
+    ROUTE_M1_C1     = 0x008, // M1 output to C1 input
+    ROUTE_M1_MEM    = 0x010, // ... to MEM
+    ROUTE_M1_C2     = 0x020, // ... to C2 input
+    ROUTE_M1_OUT    = 0x040, // ... to channel output
+    ROUTE_M2_C2     = 0x080, // M2 output to C2 input, otherwise channel output
+    ROUTE_C1_MEM    = 0x100, // C1 output to MEM, otherwise channel output
+};
+
+static const int32_t route_tab[8] = {
+    ROUTE_MEMV_M2 |ROUTE_M1_C1 |ROUTE_M2_C2|ROUTE_C1_MEM,
+    ROUTE_MEMV_M2 |ROUTE_M1_MEM|ROUTE_M2_C2|ROUTE_C1_MEM,
+    ROUTE_MEMV_M2 |ROUTE_M1_C2 |ROUTE_M2_C2|ROUTE_C1_MEM,
+    ROUTE_MEMV_C2 |ROUTE_M1_C1 |ROUTE_M2_C2|ROUTE_C1_MEM,
+    ROUTE_MEMV_MEM|ROUTE_M1_C1 |ROUTE_M2_C2,
+    ROUTE_MEMV_M2 |ROUTE_M1_MEM|ROUTE_M1_C1|ROUTE_M1_C2,
+    ROUTE_MEMV_MEM|ROUTE_M1_C1,
+    ROUTE_MEMV_MEM|ROUTE_M1_OUT,
+};
+
+#define ROUTE_MASK(_r,_bit) _mm256_cmpeq_epi32(_mm256_and_si256(_r,_mm256_set1_epi32(_bit)),_mm256_set1_epi32(_bit))
+
+// Load a field of the same operator slot in each channel (the operators
+// are stored by channel, 4 per channel).
+#define OP_LANES(_op,_field) _mm256_setr_epi32((_op)[0]._field,(_op)[4]._field,(_op)[8]._field,(_op)[12]._field, \
+                                               (_op)[16]._field,(_op)[20]._field,(_op)[24]._field,(_op)[28]._field)
+
+// Same as YM2151_op_calc1 (pm is added to the phase as is). The envelope
+// check is included in the table bounds check, since ENV_QUIET<<3 is the
+// table length.
+__attribute__((target("avx2")))
+static inline __m256i YM2151_op_avx2(const YM2151Operator* op, __m256i am, __m256i pm,
+                                     const int* tl_tab, int tl_len, const unsigned int* sin_tab)
+{
+    __m256i env, i, p, valid;
+
+    env = _mm256_add_epi32(OP_LANES(op,tl),OP_LANES(op,volume));
+    env = _mm256_add_epi32(env,_mm256_and_si256(am,OP_LANES(op,AMmask)));
+
+    i = _mm256_and_si256(OP_LANES(op,phase),_mm256_set1_epi32(0xffff0000));
+    i = _mm256_srli_epi32(_mm256_add_epi32(i,pm),16);
+    i = _mm256_and_si256(i,_mm256_set1_epi32(1023));
+    p = _mm256_i32gather_epi32((const int*)sin_tab,i,4);
+    p = _mm256_add_epi32(p,_mm256_slli_epi32(env,3));
+
+    // both are well below 2^31, so a signed compare works
+    valid = _mm256_cmpgt_epi32(_mm256_set1_epi32(tl_len),p);
+    return _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),tl_tab,p,valid,4);
+}
+
+__attribute__((target("avx2")))
+void YM2151_calc_avx2(YM2151* ym, const int* tl_tab, int tl_len,
+                      const unsigned int* sin_tab)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const YM2151Operator* op = ym->oper;
+    __m256i route, am, memv, m2, c1, c2, mem, out, prev, pm, shift, r;
+    int32_t fb_curr[8], fb_prev[8], mem_value[8];
+    int ch;
+
+    route = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i*)route_tab),
+                                        _mm256_setr_epi32(ym->connect[0],ym->connect[1],ym->connect[2],ym->connect[3],
+                                                          ym->connect[4],ym->connect[5],ym->connect[6],ym->connect[7]));
+
+    // LFO AM, the shift count is out of range (result 0) when AMS is 0
+    am = _mm256_sllv_epi32(_mm256_set1_epi32(ym->lfa),_mm256_sub_epi32(OP_LANES(op,ams),_mm256_set1_epi32(1)));
+
+    // restore delayed sample
+    memv = OP_LANES(op,mem_value);
+    m2 = _mm256_and_si256(memv,ROUTE_MASK(route,ROUTE_MEMV_M2));
+    c2 = _mm256_and_si256(memv,ROUTE_MASK(route,ROUTE_MEMV_C2));
+    mem = _mm256_and_si256(memv,ROUTE_MASK(route,ROUTE_MEMV_MEM));
+
+    // M1, outputs the previous feedback value
+    prev = OP_LANES(op,fb_out_curr);
+    c1 = _mm256_and_si256(prev,ROUTE_MASK(route,ROUTE_M1_C1));
+    mem = _mm256_add_epi32(mem,_mm256_and_si256(prev,ROUTE_MASK(route,ROUTE_M1_MEM)));
+    c2 = _mm256_add_epi32(c2,_mm256_and_si256(prev,ROUTE_MASK(route,ROUTE_M1_C2)));
+    out = _mm256_and_si256(prev,ROUTE_MASK(route,ROUTE_M1_OUT));
+
+    shift = OP_LANES(op,fb_shift);
+    pm = _mm256_add_epi32(OP_LANES(op,fb_out_prev),prev);
+    pm = _mm256_and_si256(_mm256_sllv_epi32(pm,shift),_mm256_cmpgt_epi32(shift,zero));
+    r = YM2151_op_avx2(op,am,pm,tl_tab,tl_len,sin_tab);
+    _mm256_storeu_si256((__m256i*)fb_prev,prev);
+    _mm256_storeu_si256((__m256i*)fb_curr,r);
+
+    // M2
+    r = YM2151_op_avx2(op+1,am,_mm256_slli_epi32(m2,15),tl_tab,tl_len,sin_tab);
+    pm = ROUTE_MASK(route,ROUTE_M2_C2);
+    c2 = _mm256_add_epi32(c2,_mm256_and_si256(r,pm));
+    out = _mm256_add_epi32(out,_mm256_andnot_si256(pm,r));
+
+    // C1
+    r = YM2151_op_avx2(op+2,am,_mm256_slli_epi32(c1,15),tl_tab,tl_len,sin_tab);
+    pm = ROUTE_MASK(route,ROUTE_C1_MEM);
+    mem = _mm256_add_epi32(mem,_mm256_and_si256(r,pm));
+    out = _mm256_add_epi32(out,_mm256_andnot_si256(pm,r));
+
+    // C2
+    r = YM2151_op_avx2(op+3,am,_mm256_slli_epi32(c2,15),tl_tab,tl_len,sin_tab);
+    if(ym->noise & 0x80)
+        r = _mm256_blend_epi32(r,zero,0x80);
+    out = _mm256_add_epi32(out,r);
+
+    _mm256_storeu_si256((__m256i*)mem_value,mem);
+    _mm256_storeu_si256((__m256i*)ym->chanout,out);
+
+    for(ch=0;ch<8;ch++)
+    {
+        ym->oper[ch*4].fb_out_curr = fb_curr[ch];
+        ym->oper[ch*4].fb_out_prev = fb_prev[ch];
+        ym->oper[ch*4].mem_value = mem_value[ch];
+    }
+}
+
+#endif
+
+YM2151_CalcFunc YM2151_calc_select()
+{
+#if defined(YM2151_CALC_X86)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
+        return YM2151_calc_avx2;
+#endif
+    return NULL;
+}
@@ -0,0 +1,20 @@
+/*
+    YM2151 operator kernels
+*/
+#ifndef YM2151_CALC_H_INCLUDED
+#define YM2151_CALC_H_INCLUDED
+
+#include <stdint.h>
+
+#include "ym2151.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define YM2151_CALC_X86
+void YM2151_calc_avx2(YM2151* ym, const int* tl_tab, int tl_len,
+                      const unsigned int* sin_tab);
+#endif
+
+// Pick a kernel supported by the CPU, or NULL to use YM2151_chan_calc.
+YM2151_CalcFunc YM2151_calc_select();
+
+#endif // YM2151_CALC_H_INCLUDED
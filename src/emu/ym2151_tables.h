@@ -0,0 +1,1050 @@
+// Generated by ym2151_gentab.c, do not edit.
+#ifndef YM2151_TABLES_H_INCLUDED
+#define YM2151_TABLES_H_INCLUDED
+
+static const uint32_t freq[11*768] = {
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736, 20736,
+	20736, 20800, 20800, 20800, 20800, 20864, 20864, 20864, 20928, 20928, 20928, 20928, 20992, 20992, 20992, 21056,
+	21056, 21056, 21120, 21120, 21120, 21120, 21184, 21184, 21184, 21248, 21248, 21248, 21312, 21312, 21312, 21312,
+	21376, 21376, 21376, 21440, 21440, 21440, 21440, 21504, 21504, 21504, 21568, 21568, 21568, 21632, 21632, 21632,
+	21696, 21696, 21696, 21696, 21760, 21760, 21760, 21824, 21824, 21824, 21888, 21888, 21888, 21952, 21952, 21952,
+	22016, 22016, 22016, 22016, 22080, 22080, 22080, 22144, 22144, 22144, 22208, 22208, 22208, 22272, 22272, 22272,
+	22336, 22336, 22336, 22336, 22400, 22400, 22400, 22464, 22464, 22464, 22528, 22528, 22528, 22592, 22592, 22592,
+	22656, 22656, 22656, 22656, 22720, 22720, 22720, 22784, 22784, 22784, 22848, 22848, 22848, 22912, 22912, 22912,
+	22976, 22976, 22976, 23040, 23040, 23040, 23104, 23104, 23104, 23168, 23168, 23168, 23232, 23232, 23232, 23232,
+	23296, 23296, 23360, 23360, 23360, 23424, 23424, 23424, 23488, 23488, 23488, 23552, 23552, 23552, 23616, 23616,
+	23616, 23680, 23680, 23680, 23744, 23744, 23744, 23744, 23808, 23808, 23872, 23872, 23872, 23872, 23936, 23936,
+	24000, 24000, 24000, 24064, 24064, 24064, 24128, 24128, 24192, 24192, 24192, 24192, 24256, 24256, 24320, 24320,
+	24320, 24384, 24384, 24384, 24448, 24448, 24448, 24512, 24512, 24512, 24576, 24576, 24576, 24640, 24640, 24640,
+	24704, 24704, 24704, 24768, 24768, 24768, 24832, 24832, 24896, 24896, 24896, 24896, 24960, 24960, 25024, 25024,
+	25024, 25088, 25088, 25088, 25152, 25152, 25152, 25216, 25216, 25216, 25280, 25280, 25280, 25344, 25344, 25344,
+	25408, 25408, 25472, 25472, 25472, 25536, 25536, 25536, 25600, 25600, 25664, 25664, 25664, 25728, 25728, 25728,
+	25792, 25792, 25792, 25856, 25856, 25856, 25920, 25920, 25984, 25984, 25984, 26048, 26048, 26048, 26112, 26112,
+	26176, 26176, 26176, 26240, 26240, 26240, 26304, 26304, 26368, 26368, 26368, 26432, 26432, 26432, 26496, 26496,
+	26560, 26560, 26560, 26624, 26624, 26624, 26688, 26688, 26752, 26752, 26752, 26816, 26816, 26816, 26880, 26880,
+	26944, 26944, 27008, 27008, 27008, 27072, 27072, 27072, 27136, 27136, 27200, 27200, 27200, 27264, 27264, 27264,
+	27328, 27328, 27392, 27392, 27392, 27456, 27456, 27456, 27520, 27520, 27584, 27584, 27584, 27648, 27648, 27648,
+	27712, 27712, 27776, 27776, 27840, 27840, 27840, 27904, 27904, 27968, 27968, 27968, 28032, 28032, 28032, 28096,
+	28096, 28160, 28160, 28160, 28224, 28224, 28288, 28288, 28288, 28352, 28352, 28416, 28416, 28416, 28480, 28480,
+	28544, 28544, 28608, 28608, 28608, 28672, 28672, 28736, 28736, 28736, 28800, 28800, 28864, 28864, 28864, 28928,
+	28928, 28992, 28992, 28992, 29056, 29056, 29120, 29120, 29184, 29184, 29184, 29248, 29248, 29312, 29312, 29312,
+	29376, 29376, 29440, 29440, 29440, 29504, 29504, 29568, 29568, 29568, 29632, 29632, 29696, 29696, 29696, 29760,
+	29824, 29824, 29824, 29888, 29888, 29952, 29952, 29952, 30016, 30016, 30080, 30080, 30144, 30144, 30144, 30208,
+	30208, 30272, 30272, 30272, 30336, 30336, 30400, 30400, 30464, 30464, 30464, 30528, 30528, 30592, 30592, 30592,
+	30656, 30656, 30720, 30720, 30784, 30784, 30848, 30848, 30912, 30912, 30912, 30976, 30976, 31040, 31040, 31104,
+	31104, 31104, 31168, 31168, 31232, 31232, 31296, 31296, 31360, 31360, 31360, 31424, 31424, 31488, 31488, 31552,
+	31552, 31616, 31616, 31680, 31680, 31680, 31744, 31744, 31808, 31808, 31872, 31872, 31936, 31936, 31936, 32000,
+	32000, 32064, 32064, 32128, 32128, 32128, 32192, 32192, 32256, 32256, 32320, 32320, 32384, 32384, 32448, 32448,
+	32512, 32512, 32512, 32576, 32576, 32640, 32640, 32704, 32704, 32768, 32768, 32832, 32832, 32896, 32896, 32896,
+	32960, 32960, 33024, 33024, 33088, 33088, 33152, 33152, 33216, 33216, 33280, 33280, 33344, 33344, 33408, 33408,
+	33472, 33472, 33472, 33536, 33536, 33600, 33600, 33664, 33664, 33728, 33728, 33792, 33792, 33856, 33856, 33856,
+	33920, 33920, 33984, 33984, 34048, 34048, 34112, 34112, 34176, 34176, 34240, 34240, 34304, 34304, 34368, 34368,
+	34432, 34432, 34496, 34496, 34560, 34560, 34624, 34624, 34688, 34688, 34752, 34752, 34816, 34816, 34816, 34880,
+	34944, 34944, 35008, 35008, 35072, 35072, 35136, 35136, 35200, 35200, 35264, 35264, 35328, 35328, 35328, 35392,
+	35456, 35456, 35520, 35520, 35520, 35584, 35584, 35648, 35712, 35712, 35776, 35776, 35776, 35840, 35840, 35904,
+	35968, 35968, 36032, 36032, 36096, 36096, 36160, 36160, 36224, 36224, 36288, 36288, 36352, 36352, 36416, 36416,
+	36480, 36480, 36544, 36544, 36608, 36608, 36672, 36672, 36736, 36736, 36800, 36800, 36864, 36864, 36928, 36928,
+	36992, 37056, 37056, 37120, 37120, 37184, 37184, 37248, 37248, 37312, 37312, 37376, 37376, 37440, 37440, 37504,
+	37568, 37568, 37632, 37632, 37632, 37696, 37696, 37760, 37824, 37824, 37888, 37888, 37888, 37952, 37952, 38016,
+	38080, 38144, 38144, 38208, 38208, 38272, 38272, 38336, 38336, 38400, 38400, 38464, 38464, 38528, 38528, 38592,
+	38656, 38656, 38720, 38720, 38784, 38784, 38848, 38848, 38912, 38912, 38976, 38976, 39040, 39104, 39104, 39168,
+	39232, 39232, 39296, 39296, 39296, 39360, 39360, 39424, 39488, 39488, 39552, 39552, 39616, 39680, 39680, 39744,
+	39808, 39808, 39872, 39872, 39872, 39936, 39936, 40000, 40064, 40064, 40128, 40128, 40192, 40256, 40256, 40320,
+	40384, 40384, 40448, 40448, 40448, 40512, 40512, 40576, 40640, 40640, 40704, 40704, 40768, 40832, 40832, 40896,
+	40960, 40960, 41024, 41024, 41088, 41088, 41152, 41152, 41216, 41216, 41280, 41280, 41344, 41408, 41408, 41472,
+	41536, 41600, 41600, 41664, 41664, 41728, 41728, 41792, 41856, 41856, 41920, 41920, 41984, 42048, 42048, 42112,
+	42176, 42176, 42240, 42240, 42304, 42304, 42368, 42368, 42432, 42496, 42496, 42560, 42624, 42624, 42688, 42688,
+	42752, 42816, 42816, 42880, 42880, 42944, 42944, 43008, 43072, 43072, 43136, 43136, 43200, 43264, 43264, 43328,
+	43392, 43392, 43456, 43456, 43520, 43584, 43584, 43648, 43712, 43712, 43776, 43776, 43840, 43904, 43904, 43968,
+	44032, 44032, 44096, 44096, 44160, 44224, 44224, 44288, 44352, 44352, 44416, 44416, 44480, 44544, 44544, 44608,
+	44672, 44672, 44736, 44736, 44800, 44864, 44864, 44928, 44992, 44992, 45056, 45056, 45120, 45184, 45184, 45248,
+	45312, 45312, 45376, 45376, 45440, 45504, 45504, 45568, 45632, 45632, 45696, 45760, 45760, 45824, 45888, 45888,
+	45952, 46016, 46016, 46080, 46144, 46144, 46208, 46208, 46272, 46336, 46336, 46400, 46464, 46464, 46528, 46528,
+	46656, 46656, 46720, 46720, 46784, 46848, 46848, 46912, 46976, 46976, 47040, 47104, 47104, 47168, 47232, 47232,
+	47296, 47360, 47360, 47424, 47488, 47488, 47552, 47552, 47616, 47680, 47744, 47744, 47808, 47808, 47872, 47936,
+	48000, 48064, 48064, 48128, 48192, 48192, 48256, 48320, 48384, 48384, 48448, 48448, 48512, 48576, 48640, 48640,
+	48704, 48768, 48768, 48832, 48896, 48896, 48960, 49024, 49088, 49088, 49152, 49152, 49216, 49280, 49344, 49344,
+	49408, 49472, 49472, 49536, 49600, 49600, 49664, 49728, 49792, 49792, 49856, 49856, 49920, 49984, 50048, 50048,
+	50112, 50176, 50176, 50240, 50304, 50304, 50368, 50432, 50496, 50496, 50560, 50560, 50624, 50688, 50752, 50752,
+	50880, 50880, 50944, 50944, 51008, 51072, 51136, 51136, 51200, 51264, 51328, 51328, 51392, 51456, 51456, 51520,
+	51584, 51648, 51648, 51712, 51776, 51776, 51840, 51904, 51968, 51968, 52032, 52096, 52160, 52160, 52224, 52224,
+	52352, 52416, 52416, 52480, 52544, 52544, 52608, 52672, 52736, 52736, 52800, 52864, 52928, 52928, 52992, 52992,
+	53120, 53120, 53184, 53248, 53312, 53312, 53376, 53440, 53504, 53504, 53568, 53632, 53696, 53696, 53760, 53824,
+	53888, 53952, 54016, 54016, 54080, 54144, 54208, 54208, 54272, 54336, 54400, 54400, 54464, 54528, 54592, 54592,
+	54656, 54720, 54784, 54784, 54848, 54912, 54976, 54976, 55040, 55104, 55168, 55168, 55232, 55296, 55360, 55360,
+	55488, 55488, 55552, 55616, 55680, 55680, 55744, 55808, 55872, 55936, 55936, 56000, 56064, 56128, 56128, 56192,
+	56256, 56320, 56384, 56384, 56448, 56512, 56576, 56576, 56640, 56704, 56768, 56832, 56832, 56896, 56960, 57024,
+	57088, 57152, 57216, 57216, 57280, 57344, 57408, 57472, 57536, 57536, 57600, 57664, 57728, 57792, 57792, 57856,
+	57920, 57984, 58048, 58048, 58112, 58176, 58240, 58304, 58368, 58368, 58432, 58496, 58560, 58624, 58624, 58688,
+	58752, 58816, 58880, 58880, 58944, 59008, 59072, 59136, 59200, 59200, 59264, 59328, 59392, 59456, 59456, 59520,
+	59648, 59648, 59712, 59776, 59840, 59904, 59904, 59968, 60032, 60096, 60160, 60224, 60288, 60288, 60352, 60416,
+	60480, 60544, 60608, 60608, 60672, 60736, 60800, 60864, 60928, 60992, 60992, 61056, 61120, 61184, 61248, 61248,
+	61376, 61376, 61440, 61504, 61568, 61632, 61696, 61760, 61824, 61824, 61888, 61952, 62016, 62080, 62144, 62208,
+	62272, 62272, 62336, 62400, 62464, 62528, 62592, 62656, 62720, 62720, 62784, 62848, 62912, 62976, 63040, 63104,
+	63168, 63232, 63296, 63360, 63424, 63424, 63488, 63552, 63616, 63680, 63744, 63808, 63872, 63872, 63936, 64000,
+	64064, 64128, 64192, 64256, 64320, 64320, 64384, 64448, 64512, 64576, 64640, 64704, 64768, 64832, 64896, 64896,
+	65024, 65024, 65088, 65152, 65216, 65280, 65344, 65408, 65472, 65536, 65600, 65664, 65728, 65792, 65856, 65856,
+	65984, 65984, 66048, 66112, 66176, 66240, 66304, 66368, 66432, 66496, 66560, 66624, 66688, 66752, 66816, 66816,
+	66944, 66944, 67008, 67072, 67136, 67200, 67264, 67328, 67392, 67456, 67520, 67584, 67648, 67712, 67776, 67776,
+	67904, 67904, 67968, 68032, 68096, 68160, 68224, 68288, 68352, 68416, 68480, 68544, 68608, 68672, 68736, 68800,
+	68864, 68928, 68992, 69056, 69120, 69184, 69248, 69248, 69376, 69440, 69504, 69504, 69632, 69632, 69696, 69760,
+	69888, 69952, 70016, 70080, 70144, 70208, 70272, 70272, 70400, 70464, 70528, 70528, 70656, 70656, 70720, 70784,
+	70912, 70976, 71040, 71104, 71104, 71232, 71232, 71360, 71424, 71488, 71552, 71616, 71616, 71744, 71744, 71872,
+	71936, 72000, 72064, 72128, 72192, 72256, 72320, 72384, 72448, 72512, 72576, 72640, 72704, 72768, 72832, 72896,
+	72960, 73024, 73088, 73152, 73216, 73280, 73344, 73408, 73472, 73536, 73600, 73664, 73728, 73792, 73856, 73920,
+	74048, 74112, 74176, 74240, 74304, 74368, 74432, 74496, 74560, 74624, 74688, 74752, 74816, 74880, 74944, 75008,
+	75136, 75200, 75264, 75328, 75328, 75456, 75456, 75584, 75648, 75712, 75776, 75840, 75840, 75968, 75968, 76096,
+	76224, 76288, 76352, 76416, 76416, 76544, 76544, 76672, 76736, 76800, 76864, 76928, 76992, 77120, 77120, 77248,
+	77312, 77376, 77440, 77504, 77568, 77632, 77696, 77760, 77824, 77888, 77952, 78016, 78144, 78208, 78272, 78336,
+	78464, 78528, 78592, 78656, 78656, 78784, 78784, 78912, 78976, 79040, 79104, 79168, 79232, 79360, 79360, 79488,
+	79616, 79680, 79744, 79808, 79808, 79936, 79936, 80064, 80128, 80192, 80256, 80320, 80384, 80512, 80512, 80640,
+	80768, 80832, 80896, 80960, 80960, 81088, 81088, 81216, 81280, 81344, 81408, 81472, 81536, 81664, 81664, 81792,
+	81920, 81984, 82048, 82112, 82176, 82240, 82304, 82368, 82432, 82496, 82560, 82624, 82752, 82816, 82880, 82944,
+	83136, 83200, 83264, 83328, 83392, 83456, 83520, 83584, 83712, 83776, 83840, 83904, 84032, 84096, 84160, 84224,
+	84352, 84416, 84480, 84544, 84608, 84672, 84736, 84800, 84928, 84992, 85056, 85120, 85248, 85312, 85376, 85440,
+	85568, 85632, 85696, 85760, 85824, 85888, 85952, 86016, 86144, 86208, 86272, 86336, 86464, 86528, 86592, 86656,
+	86784, 86848, 86912, 86976, 87104, 87168, 87232, 87296, 87424, 87488, 87552, 87616, 87744, 87808, 87872, 87936,
+	88064, 88128, 88192, 88256, 88384, 88448, 88512, 88576, 88704, 88768, 88832, 88896, 89024, 89088, 89152, 89216,
+	89344, 89408, 89472, 89536, 89664, 89728, 89792, 89856, 89984, 90048, 90112, 90176, 90304, 90368, 90432, 90496,
+	90624, 90688, 90752, 90816, 90944, 91008, 91072, 91136, 91264, 91328, 91456, 91520, 91584, 91648, 91776, 91840,
+	91968, 92032, 92096, 92160, 92288, 92352, 92416, 92480, 92608, 92672, 92736, 92800, 92928, 92992, 93056, 93120,
+	93312, 93376, 93440, 93504, 93632, 93696, 93760, 93824, 93952, 94016, 94144, 94208, 94272, 94336, 94464, 94528,
+	94656, 94720, 94784, 94848, 94976, 95040, 95104, 95168, 95296, 95360, 95488, 95552, 95616, 95680, 95808, 95872,
+	96064, 96128, 96192, 96256, 96384, 96448, 96576, 96640, 96768, 96832, 96896, 96960, 97088, 97152, 97280, 97344,
+	97472, 97536, 97600, 97664, 97792, 97856, 97984, 98048, 98176, 98240, 98304, 98368, 98496, 98560, 98688, 98752,
+	98880, 98944, 99008, 99072, 99200, 99264, 99392, 99456, 99584, 99648, 99712, 99776, 99904, 99968, 100096, 100160,
+	100288, 100352, 100416, 100480, 100608, 100672, 100800, 100864, 100992, 101056, 101120, 101184, 101312, 101376, 101504, 101568,
+	101760, 101824, 101888, 101952, 102080, 102144, 102272, 102336, 102464, 102528, 102656, 102720, 102848, 102912, 102976, 103040,
+	103232, 103296, 103360, 103424, 103552, 103616, 103744, 103808, 103936, 104000, 104128, 104192, 104320, 104384, 104448, 104512,
+	104768, 104832, 104896, 104960, 105088, 105152, 105280, 105344, 105472, 105536, 105664, 105728, 105856, 105920, 105984, 106048,
+	106240, 106304, 106432, 106496, 106624, 106688, 106816, 106880, 107008, 107072, 107200, 107264, 107392, 107456, 107584, 107648,
+	107840, 107904, 108032, 108096, 108224, 108288, 108416, 108480, 108608, 108672, 108800, 108864, 108992, 109056, 109184, 109248,
+	109376, 109440, 109568, 109632, 109760, 109824, 109952, 110016, 110144, 110208, 110336, 110400, 110528, 110592, 110720, 110784,
+	110976, 111040, 111168, 111232, 111360, 111424, 111552, 111616, 111744, 111872, 111936, 112064, 112128, 112256, 112320, 112448,
+	112576, 112640, 112768, 112832, 112960, 113024, 113152, 113216, 113344, 113472, 113536, 113664, 113728, 113856, 113920, 114048,
+	114240, 114304, 114432, 114496, 114624, 114752, 114816, 114944, 115072, 115136, 115264, 115328, 115456, 115584, 115648, 115776,
+	115904, 115968, 116096, 116160, 116288, 116416, 116480, 116608, 116736, 116800, 116928, 116992, 117120, 117248, 117312, 117440,
+	117568, 117632, 117760, 117824, 117952, 118080, 118144, 118272, 118400, 118464, 118592, 118656, 118784, 118912, 118976, 119104,
+	119296, 119360, 119488, 119552, 119680, 119808, 119872, 120000, 120128, 120256, 120320, 120448, 120576, 120640, 120768, 120832,
+	121024, 121088, 121216, 121280, 121408, 121536, 121600, 121728, 121856, 121984, 122048, 122176, 122304, 122368, 122496, 122560,
+	122752, 122816, 122944, 123072, 123200, 123264, 123392, 123520, 123648, 123712, 123840, 123968, 124096, 124160, 124288, 124416,
+	124544, 124608, 124736, 124864, 124992, 125056, 125184, 125312, 125440, 125504, 125632, 125760, 125888, 125952, 126080, 126208,
+	126400, 126464, 126592, 126720, 126848, 126912, 127040, 127168, 127296, 127360, 127488, 127616, 127744, 127808, 127936, 128064,
+	128192, 128256, 128384, 128512, 128640, 128704, 128832, 128960, 129088, 129216, 129344, 129408, 129536, 129664, 129792, 129856,
+	130048, 130112, 130240, 130368, 130496, 130624, 130752, 130816, 131008, 131072, 131200, 131328, 131456, 131584, 131712, 131776,
+	131968, 132032, 132160, 132288, 132416, 132544, 132672, 132736, 132928, 132992, 133120, 133248, 133376, 133504, 133632, 133696,
+	133888, 133952, 134080, 134208, 134336, 134464, 134592, 134656, 134848, 134912, 135040, 135168, 135296, 135424, 135552, 135616,
+	135808, 135872, 136000, 136128, 136256, 136384, 136512, 136576, 136768, 136896, 137024, 137088, 137280, 137344, 137472, 137600,
+	137792, 137856, 137984, 138112, 138240, 138368, 138496, 138560, 138752, 138880, 139008, 139072, 139264, 139328, 139456, 139584,
+	139840, 139904, 140032, 140160, 140288, 140416, 140544, 140608, 140800, 140928, 141056, 141120, 141312, 141376, 141504, 141632,
+	141824, 141952, 142080, 142208, 142272, 142464, 142528, 142720, 142848, 142976, 143104, 143232, 143296, 143488, 143552, 143744,
+	143936, 144064, 144192, 144320, 144384, 144576, 144640, 144832, 144960, 145088, 145216, 145344, 145408, 145600, 145664, 145856,
+	145984, 146112, 146240, 146368, 146432, 146624, 146688, 146880, 147008, 147136, 147264, 147392, 147456, 147648, 147712, 147904,
+	148160, 148288, 148416, 148544, 148608, 148800, 148864, 149056, 149184, 149312, 149440, 149568, 149632, 149824, 149888, 150080,
+	150272, 150400, 150528, 150656, 150720, 150912, 150976, 151168, 151296, 151424, 151552, 151680, 151744, 151936, 152000, 152192,
+	152448, 152576, 152704, 152832, 152896, 153088, 153152, 153344, 153472, 153600, 153728, 153856, 154048, 154240, 154304, 154496,
+	154688, 154816, 154944, 155072, 155136, 155328, 155392, 155584, 155712, 155840, 155968, 156096, 156288, 156480, 156544, 156736,
+	156928, 157056, 157184, 157312, 157376, 157568, 157632, 157824, 157952, 158080, 158208, 158336, 158528, 158720, 158784, 158976,
+	159232, 159360, 159488, 159616, 159680, 159872, 159936, 160128, 160256, 160384, 160512, 160640, 160832, 161024, 161088, 161280,
+	161536, 161664, 161792, 161920, 161984, 162176, 162240, 162432, 162560, 162688, 162816, 162944, 163136, 163328, 163392, 163584,
+	163904, 164032, 164160, 164288, 164352, 164544, 164608, 164800, 164928, 165056, 165184, 165312, 165504, 165696, 165760, 165952,
+	166272, 166400, 166528, 166656, 166784, 166912, 167040, 167168, 167424, 167552, 167680, 167808, 168064, 168192, 168320, 168448,
+	168704, 168832, 168960, 169088, 169216, 169344, 169472, 169600, 169856, 169984, 170112, 170240, 170496, 170624, 170752, 170880,
+	171136, 171264, 171392, 171520, 171648, 171776, 171904, 172032, 172288, 172416, 172544, 172672, 172928, 173056, 173184, 173312,
+	173568, 173696, 173824, 173952, 174208, 174336, 174464, 174592, 174848, 174976, 175104, 175232, 175488, 175616, 175744, 175872,
+	176128, 176256, 176384, 176512, 176768, 176896, 177024, 177152, 177408, 177536, 177664, 177792, 178048, 178176, 178304, 178432,
+	178688, 178816, 178944, 179072, 179328, 179456, 179584, 179712, 179968, 180096, 180224, 180352, 180608, 180736, 180864, 180992,
+	181248, 181376, 181504, 181632, 181888, 182016, 182144, 182272, 182528, 182656, 182912, 183040, 183168, 183296, 183552, 183680,
+	183936, 184064, 184192, 184320, 184576, 184704, 184832, 184960, 185216, 185344, 185472, 185600, 185856, 185984, 186112, 186240,
+	186624, 186752, 186880, 187008, 187264, 187392, 187520, 187648, 187904, 188032, 188288, 188416, 188544, 188672, 188928, 189056,
+	189312, 189440, 189568, 189696, 189952, 190080, 190208, 190336, 190592, 190720, 190976, 191104, 191232, 191360, 191616, 191744,
+	192128, 192256, 192384, 192512, 192768, 192896, 193152, 193280, 193536, 193664, 193792, 193920, 194176, 194304, 194560, 194688,
+	194944, 195072, 195200, 195328, 195584, 195712, 195968, 196096, 196352, 196480, 196608, 196736, 196992, 197120, 197376, 197504,
+	197760, 197888, 198016, 198144, 198400, 198528, 198784, 198912, 199168, 199296, 199424, 199552, 199808, 199936, 200192, 200320,
+	200576, 200704, 200832, 200960, 201216, 201344, 201600, 201728, 201984, 202112, 202240, 202368, 202624, 202752, 203008, 203136,
+	203520, 203648, 203776, 203904, 204160, 204288, 204544, 204672, 204928, 205056, 205312, 205440, 205696, 205824, 205952, 206080,
+	206464, 206592, 206720, 206848, 207104, 207232, 207488, 207616, 207872, 208000, 208256, 208384, 208640, 208768, 208896, 209024,
+	209536, 209664, 209792, 209920, 210176, 210304, 210560, 210688, 210944, 211072, 211328, 211456, 211712, 211840, 211968, 212096,
+	212480, 212608, 212864, 212992, 213248, 213376, 213632, 213760, 214016, 214144, 214400, 214528, 214784, 214912, 215168, 215296,
+	215680, 215808, 216064, 216192, 216448, 216576, 216832, 216960, 217216, 217344, 217600, 217728, 217984, 218112, 218368, 218496,
+	218752, 218880, 219136, 219264, 219520, 219648, 219904, 220032, 220288, 220416, 220672, 220800, 221056, 221184, 221440, 221568,
+	221952, 222080, 222336, 222464, 222720, 222848, 223104, 223232, 223488, 223744, 223872, 224128, 224256, 224512, 224640, 224896,
+	225152, 225280, 225536, 225664, 225920, 226048, 226304, 226432, 226688, 226944, 227072, 227328, 227456, 227712, 227840, 228096,
+	228480, 228608, 228864, 228992, 229248, 229504, 229632, 229888, 230144, 230272, 230528, 230656, 230912, 231168, 231296, 231552,
+	231808, 231936, 232192, 232320, 232576, 232832, 232960, 233216, 233472, 233600, 233856, 233984, 234240, 234496, 234624, 234880,
+	235136, 235264, 235520, 235648, 235904, 236160, 236288, 236544, 236800, 236928, 237184, 237312, 237568, 237824, 237952, 238208,
+	238592, 238720, 238976, 239104, 239360, 239616, 239744, 240000, 240256, 240512, 240640, 240896, 241152, 241280, 241536, 241664,
+	242048, 242176, 242432, 242560, 242816, 243072, 243200, 243456, 243712, 243968, 244096, 244352, 244608, 244736, 244992, 245120,
+	245504, 245632, 245888, 246144, 246400, 246528, 246784, 247040, 247296, 247424, 247680, 247936, 248192, 248320, 248576, 248832,
+	249088, 249216, 249472, 249728, 249984, 250112, 250368, 250624, 250880, 251008, 251264, 251520, 251776, 251904, 252160, 252416,
+	252800, 252928, 253184, 253440, 253696, 253824, 254080, 254336, 254592, 254720, 254976, 255232, 255488, 255616, 255872, 256128,
+	256384, 256512, 256768, 257024, 257280, 257408, 257664, 257920, 258176, 258432, 258688, 258816, 259072, 259328, 259584, 259712,
+	260096, 260224, 260480, 260736, 260992, 261248, 261504, 261632, 262016, 262144, 262400, 262656, 262912, 263168, 263424, 263552,
+	263936, 264064, 264320, 264576, 264832, 265088, 265344, 265472, 265856, 265984, 266240, 266496, 266752, 267008, 267264, 267392,
+	267776, 267904, 268160, 268416, 268672, 268928, 269184, 269312, 269696, 269824, 270080, 270336, 270592, 270848, 271104, 271232,
+	271616, 271744, 272000, 272256, 272512, 272768, 273024, 273152, 273536, 273792, 274048, 274176, 274560, 274688, 274944, 275200,
+	275584, 275712, 275968, 276224, 276480, 276736, 276992, 277120, 277504, 277760, 278016, 278144, 278528, 278656, 278912, 279168,
+	279680, 279808, 280064, 280320, 280576, 280832, 281088, 281216, 281600, 281856, 282112, 282240, 282624, 282752, 283008, 283264,
+	283648, 283904, 284160, 284416, 284544, 284928, 285056, 285440, 285696, 285952, 286208, 286464, 286592, 286976, 287104, 287488,
+	287872, 288128, 288384, 288640, 288768, 289152, 289280, 289664, 289920, 290176, 290432, 290688, 290816, 291200, 291328, 291712,
+	291968, 292224, 292480, 292736, 292864, 293248, 293376, 293760, 294016, 294272, 294528, 294784, 294912, 295296, 295424, 295808,
+	296320, 296576, 296832, 297088, 297216, 297600, 297728, 298112, 298368, 298624, 298880, 299136, 299264, 299648, 299776, 300160,
+	300544, 300800, 301056, 301312, 301440, 301824, 301952, 302336, 302592, 302848, 303104, 303360, 303488, 303872, 304000, 304384,
+	304896, 305152, 305408, 305664, 305792, 306176, 306304, 306688, 306944, 307200, 307456, 307712, 308096, 308480, 308608, 308992,
+	309376, 309632, 309888, 310144, 310272, 310656, 310784, 311168, 311424, 311680, 311936, 312192, 312576, 312960, 313088, 313472,
+	313856, 314112, 314368, 314624, 314752, 315136, 315264, 315648, 315904, 316160, 316416, 316672, 317056, 317440, 317568, 317952,
+	318464, 318720, 318976, 319232, 319360, 319744, 319872, 320256, 320512, 320768, 321024, 321280, 321664, 322048, 322176, 322560,
+	323072, 323328, 323584, 323840, 323968, 324352, 324480, 324864, 325120, 325376, 325632, 325888, 326272, 326656, 326784, 327168,
+	327808, 328064, 328320, 328576, 328704, 329088, 329216, 329600, 329856, 330112, 330368, 330624, 331008, 331392, 331520, 331904,
+	332544, 332800, 333056, 333312, 333568, 333824, 334080, 334336, 334848, 335104, 335360, 335616, 336128, 336384, 336640, 336896,
+	337408, 337664, 337920, 338176, 338432, 338688, 338944, 339200, 339712, 339968, 340224, 340480, 340992, 341248, 341504, 341760,
+	342272, 342528, 342784, 343040, 343296, 343552, 343808, 344064, 344576, 344832, 345088, 345344, 345856, 346112, 346368, 346624,
+	347136, 347392, 347648, 347904, 348416, 348672, 348928, 349184, 349696, 349952, 350208, 350464, 350976, 351232, 351488, 351744,
+	352256, 352512, 352768, 353024, 353536, 353792, 354048, 354304, 354816, 355072, 355328, 355584, 356096, 356352, 356608, 356864,
+	357376, 357632, 357888, 358144, 358656, 358912, 359168, 359424, 359936, 360192, 360448, 360704, 361216, 361472, 361728, 361984,
+	362496, 362752, 363008, 363264, 363776, 364032, 364288, 364544, 365056, 365312, 365824, 366080, 366336, 366592, 367104, 367360,
+	367872, 368128, 368384, 368640, 369152, 369408, 369664, 369920, 370432, 370688, 370944, 371200, 371712, 371968, 372224, 372480,
+	373248, 373504, 373760, 374016, 374528, 374784, 375040, 375296, 375808, 376064, 376576, 376832, 377088, 377344, 377856, 378112,
+	378624, 378880, 379136, 379392, 379904, 380160, 380416, 380672, 381184, 381440, 381952, 382208, 382464, 382720, 383232, 383488,
+	384256, 384512, 384768, 385024, 385536, 385792, 386304, 386560, 387072, 387328, 387584, 387840, 388352, 388608, 389120, 389376,
+	389888, 390144, 390400, 390656, 391168, 391424, 391936, 392192, 392704, 392960, 393216, 393472, 393984, 394240, 394752, 395008,
+	395520, 395776, 396032, 396288, 396800, 397056, 397568, 397824, 398336, 398592, 398848, 399104, 399616, 399872, 400384, 400640,
+	401152, 401408, 401664, 401920, 402432, 402688, 403200, 403456, 403968, 404224, 404480, 404736, 405248, 405504, 406016, 406272,
+	407040, 407296, 407552, 407808, 408320, 408576, 409088, 409344, 409856, 410112, 410624, 410880, 411392, 411648, 411904, 412160,
+	412928, 413184, 413440, 413696, 414208, 414464, 414976, 415232, 415744, 416000, 416512, 416768, 417280, 417536, 417792, 418048,
+	419072, 419328, 419584, 419840, 420352, 420608, 421120, 421376, 421888, 422144, 422656, 422912, 423424, 423680, 423936, 424192,
+	424960, 425216, 425728, 425984, 426496, 426752, 427264, 427520, 428032, 428288, 428800, 429056, 429568, 429824, 430336, 430592,
+	431360, 431616, 432128, 432384, 432896, 433152, 433664, 433920, 434432, 434688, 435200, 435456, 435968, 436224, 436736, 436992,
+	437504, 437760, 438272, 438528, 439040, 439296, 439808, 440064, 440576, 440832, 441344, 441600, 442112, 442368, 442880, 443136,
+	443904, 444160, 444672, 444928, 445440, 445696, 446208, 446464, 446976, 447488, 447744, 448256, 448512, 449024, 449280, 449792,
+	450304, 450560, 451072, 451328, 451840, 452096, 452608, 452864, 453376, 453888, 454144, 454656, 454912, 455424, 455680, 456192,
+	456960, 457216, 457728, 457984, 458496, 459008, 459264, 459776, 460288, 460544, 461056, 461312, 461824, 462336, 462592, 463104,
+	463616, 463872, 464384, 464640, 465152, 465664, 465920, 466432, 466944, 467200, 467712, 467968, 468480, 468992, 469248, 469760,
+	470272, 470528, 471040, 471296, 471808, 472320, 472576, 473088, 473600, 473856, 474368, 474624, 475136, 475648, 475904, 476416,
+	477184, 477440, 477952, 478208, 478720, 479232, 479488, 480000, 480512, 481024, 481280, 481792, 482304, 482560, 483072, 483328,
+	484096, 484352, 484864, 485120, 485632, 486144, 486400, 486912, 487424, 487936, 488192, 488704, 489216, 489472, 489984, 490240,
+	491008, 491264, 491776, 492288, 492800, 493056, 493568, 494080, 494592, 494848, 495360, 495872, 496384, 496640, 497152, 497664,
+	498176, 498432, 498944, 499456, 499968, 500224, 500736, 501248, 501760, 502016, 502528, 503040, 503552, 503808, 504320, 504832,
+	505600, 505856, 506368, 506880, 507392, 507648, 508160, 508672, 509184, 509440, 509952, 510464, 510976, 511232, 511744, 512256,
+	512768, 513024, 513536, 514048, 514560, 514816, 515328, 515840, 516352, 516864, 517376, 517632, 518144, 518656, 519168, 519424,
+	520192, 520448, 520960, 521472, 521984, 522496, 523008, 523264, 524032, 524288, 524800, 525312, 525824, 526336, 526848, 527104,
+	527872, 528128, 528640, 529152, 529664, 530176, 530688, 530944, 531712, 531968, 532480, 532992, 533504, 534016, 534528, 534784,
+	535552, 535808, 536320, 536832, 537344, 537856, 538368, 538624, 539392, 539648, 540160, 540672, 541184, 541696, 542208, 542464,
+	543232, 543488, 544000, 544512, 545024, 545536, 546048, 546304, 547072, 547584, 548096, 548352, 549120, 549376, 549888, 550400,
+	551168, 551424, 551936, 552448, 552960, 553472, 553984, 554240, 555008, 555520, 556032, 556288, 557056, 557312, 557824, 558336,
+	559360, 559616, 560128, 560640, 561152, 561664, 562176, 562432, 563200, 563712, 564224, 564480, 565248, 565504, 566016, 566528,
+	567296, 567808, 568320, 568832, 569088, 569856, 570112, 570880, 571392, 571904, 572416, 572928, 573184, 573952, 574208, 574976,
+	575744, 576256, 576768, 577280, 577536, 578304, 578560, 579328, 579840, 580352, 580864, 581376, 581632, 582400, 582656, 583424,
+	583936, 584448, 584960, 585472, 585728, 586496, 586752, 587520, 588032, 588544, 589056, 589568, 589824, 590592, 590848, 591616,
+	592640, 593152, 593664, 594176, 594432, 595200, 595456, 596224, 596736, 597248, 597760, 598272, 598528, 599296, 599552, 600320,
+	601088, 601600, 602112, 602624, 602880, 603648, 603904, 604672, 605184, 605696, 606208, 606720, 606976, 607744, 608000, 608768,
+	609792, 610304, 610816, 611328, 611584, 612352, 612608, 613376, 613888, 614400, 614912, 615424, 616192, 616960, 617216, 617984,
+	618752, 619264, 619776, 620288, 620544, 621312, 621568, 622336, 622848, 623360, 623872, 624384, 625152, 625920, 626176, 626944,
+	627712, 628224, 628736, 629248, 629504, 630272, 630528, 631296, 631808, 632320, 632832, 633344, 634112, 634880, 635136, 635904,
+	636928, 637440, 637952, 638464, 638720, 639488, 639744, 640512, 641024, 641536, 642048, 642560, 643328, 644096, 644352, 645120,
+	646144, 646656, 647168, 647680, 647936, 648704, 648960, 649728, 650240, 650752, 651264, 651776, 652544, 653312, 653568, 654336,
+	655616, 656128, 656640, 657152, 657408, 658176, 658432, 659200, 659712, 660224, 660736, 661248, 662016, 662784, 663040, 663808,
+	665088, 665600, 666112, 666624, 667136, 667648, 668160, 668672, 669696, 670208, 670720, 671232, 672256, 672768, 673280, 673792,
+	674816, 675328, 675840, 676352, 676864, 677376, 677888, 678400, 679424, 679936, 680448, 680960, 681984, 682496, 683008, 683520,
+	684544, 685056, 685568, 686080, 686592, 687104, 687616, 688128, 689152, 689664, 690176, 690688, 691712, 692224, 692736, 693248,
+	694272, 694784, 695296, 695808, 696832, 697344, 697856, 698368, 699392, 699904, 700416, 700928, 701952, 702464, 702976, 703488,
+	704512, 705024, 705536, 706048, 707072, 707584, 708096, 708608, 709632, 710144, 710656, 711168, 712192, 712704, 713216, 713728,
+	714752, 715264, 715776, 716288, 717312, 717824, 718336, 718848, 719872, 720384, 720896, 721408, 722432, 722944, 723456, 723968,
+	724992, 725504, 726016, 726528, 727552, 728064, 728576, 729088, 730112, 730624, 731648, 732160, 732672, 733184, 734208, 734720,
+	735744, 736256, 736768, 737280, 738304, 738816, 739328, 739840, 740864, 741376, 741888, 742400, 743424, 743936, 744448, 744960,
+	746496, 747008, 747520, 748032, 749056, 749568, 750080, 750592, 751616, 752128, 753152, 753664, 754176, 754688, 755712, 756224,
+	757248, 757760, 758272, 758784, 759808, 760320, 760832, 761344, 762368, 762880, 763904, 764416, 764928, 765440, 766464, 766976,
+	768512, 769024, 769536, 770048, 771072, 771584, 772608, 773120, 774144, 774656, 775168, 775680, 776704, 777216, 778240, 778752,
+	779776, 780288, 780800, 781312, 782336, 782848, 783872, 784384, 785408, 785920, 786432, 786944, 787968, 788480, 789504, 790016,
+	791040, 791552, 792064, 792576, 793600, 794112, 795136, 795648, 796672, 797184, 797696, 798208, 799232, 799744, 800768, 801280,
+	802304, 802816, 803328, 803840, 804864, 805376, 806400, 806912, 807936, 808448, 808960, 809472, 810496, 811008, 812032, 812544,
+	814080, 814592, 815104, 815616, 816640, 817152, 818176, 818688, 819712, 820224, 821248, 821760, 822784, 823296, 823808, 824320,
+	825856, 826368, 826880, 827392, 828416, 828928, 829952, 830464, 831488, 832000, 833024, 833536, 834560, 835072, 835584, 836096,
+	838144, 838656, 839168, 839680, 840704, 841216, 842240, 842752, 843776, 844288, 845312, 845824, 846848, 847360, 847872, 848384,
+	849920, 850432, 851456, 851968, 852992, 853504, 854528, 855040, 856064, 856576, 857600, 858112, 859136, 859648, 860672, 861184,
+	862720, 863232, 864256, 864768, 865792, 866304, 867328, 867840, 868864, 869376, 870400, 870912, 871936, 872448, 873472, 873984,
+	875008, 875520, 876544, 877056, 878080, 878592, 879616, 880128, 881152, 881664, 882688, 883200, 884224, 884736, 885760, 886272,
+	887808, 888320, 889344, 889856, 890880, 891392, 892416, 892928, 893952, 894976, 895488, 896512, 897024, 898048, 898560, 899584,
+	900608, 901120, 902144, 902656, 903680, 904192, 905216, 905728, 906752, 907776, 908288, 909312, 909824, 910848, 911360, 912384,
+	913920, 914432, 915456, 915968, 916992, 918016, 918528, 919552, 920576, 921088, 922112, 922624, 923648, 924672, 925184, 926208,
+	927232, 927744, 928768, 929280, 930304, 931328, 931840, 932864, 933888, 934400, 935424, 935936, 936960, 937984, 938496, 939520,
+	940544, 941056, 942080, 942592, 943616, 944640, 945152, 946176, 947200, 947712, 948736, 949248, 950272, 951296, 951808, 952832,
+	954368, 954880, 955904, 956416, 957440, 958464, 958976, 960000, 961024, 962048, 962560, 963584, 964608, 965120, 966144, 966656,
+	968192, 968704, 969728, 970240, 971264, 972288, 972800, 973824, 974848, 975872, 976384, 977408, 978432, 978944, 979968, 980480,
+	982016, 982528, 983552, 984576, 985600, 986112, 987136, 988160, 989184, 989696, 990720, 991744, 992768, 993280, 994304, 995328,
+	996352, 996864, 997888, 998912, 999936, 1000448, 1001472, 1002496, 1003520, 1004032, 1005056, 1006080, 1007104, 1007616, 1008640, 1009664,
+	1011200, 1011712, 1012736, 1013760, 1014784, 1015296, 1016320, 1017344, 1018368, 1018880, 1019904, 1020928, 1021952, 1022464, 1023488, 1024512,
+	1025536, 1026048, 1027072, 1028096, 1029120, 1029632, 1030656, 1031680, 1032704, 1033728, 1034752, 1035264, 1036288, 1037312, 1038336, 1038848,
+	1040384, 1040896, 1041920, 1042944, 1043968, 1044992, 1046016, 1046528, 1048064, 1048576, 1049600, 1050624, 1051648, 1052672, 1053696, 1054208,
+	1055744, 1056256, 1057280, 1058304, 1059328, 1060352, 1061376, 1061888, 1063424, 1063936, 1064960, 1065984, 1067008, 1068032, 1069056, 1069568,
+	1071104, 1071616, 1072640, 1073664, 1074688, 1075712, 1076736, 1077248, 1078784, 1079296, 1080320, 1081344, 1082368, 1083392, 1084416, 1084928,
+	1086464, 1086976, 1088000, 1089024, 1090048, 1091072, 1092096, 1092608, 1094144, 1095168, 1096192, 1096704, 1098240, 1098752, 1099776, 1100800,
+	1102336, 1102848, 1103872, 1104896, 1105920, 1106944, 1107968, 1108480, 1110016, 1111040, 1112064, 1112576, 1114112, 1114624, 1115648, 1116672,
+	1118720, 1119232, 1120256, 1121280, 1122304, 1123328, 1124352, 1124864, 1126400, 1127424, 1128448, 1128960, 1130496, 1131008, 1132032, 1133056,
+	1134592, 1135616, 1136640, 1137664, 1138176, 1139712, 1140224, 1141760, 1142784, 1143808, 1144832, 1145856, 1146368, 1147904, 1148416, 1149952,
+	1151488, 1152512, 1153536, 1154560, 1155072, 1156608, 1157120, 1158656, 1159680, 1160704, 1161728, 1162752, 1163264, 1164800, 1165312, 1166848,
+	1167872, 1168896, 1169920, 1170944, 1171456, 1172992, 1173504, 1175040, 1176064, 1177088, 1178112, 1179136, 1179648, 1181184, 1181696, 1183232,
+	1185280, 1186304, 1187328, 1188352, 1188864, 1190400, 1190912, 1192448, 1193472, 1194496, 1195520, 1196544, 1197056, 1198592, 1199104, 1200640,
+	1202176, 1203200, 1204224, 1205248, 1205760, 1207296, 1207808, 1209344, 1210368, 1211392, 1212416, 1213440, 1213952, 1215488, 1216000, 1217536,
+	1219584, 1220608, 1221632, 1222656, 1223168, 1224704, 1225216, 1226752, 1227776, 1228800, 1229824, 1230848, 1232384, 1233920, 1234432, 1235968,
+	1237504, 1238528, 1239552, 1240576, 1241088, 1242624, 1243136, 1244672, 1245696, 1246720, 1247744, 1248768, 1250304, 1251840, 1252352, 1253888,
+	1255424, 1256448, 1257472, 1258496, 1259008, 1260544, 1261056, 1262592, 1263616, 1264640, 1265664, 1266688, 1268224, 1269760, 1270272, 1271808,
+	1273856, 1274880, 1275904, 1276928, 1277440, 1278976, 1279488, 1281024, 1282048, 1283072, 1284096, 1285120, 1286656, 1288192, 1288704, 1290240,
+	1292288, 1293312, 1294336, 1295360, 1295872, 1297408, 1297920, 1299456, 1300480, 1301504, 1302528, 1303552, 1305088, 1306624, 1307136, 1308672,
+	1311232, 1312256, 1313280, 1314304, 1314816, 1316352, 1316864, 1318400, 1319424, 1320448, 1321472, 1322496, 1324032, 1325568, 1326080, 1327616,
+	1330176, 1331200, 1332224, 1333248, 1334272, 1335296, 1336320, 1337344, 1339392, 1340416, 1341440, 1342464, 1344512, 1345536, 1346560, 1347584,
+	1349632, 1350656, 1351680, 1352704, 1353728, 1354752, 1355776, 1356800, 1358848, 1359872, 1360896, 1361920, 1363968, 1364992, 1366016, 1367040,
+	1369088, 1370112, 1371136, 1372160, 1373184, 1374208, 1375232, 1376256, 1378304, 1379328, 1380352, 1381376, 1383424, 1384448, 1385472, 1386496,
+	1388544, 1389568, 1390592, 1391616, 1393664, 1394688, 1395712, 1396736, 1398784, 1399808, 1400832, 1401856, 1403904, 1404928, 1405952, 1406976,
+	1409024, 1410048, 1411072, 1412096, 1414144, 1415168, 1416192, 1417216, 1419264, 1420288, 1421312, 1422336, 1424384, 1425408, 1426432, 1427456,
+	1429504, 1430528, 1431552, 1432576, 1434624, 1435648, 1436672, 1437696, 1439744, 1440768, 1441792, 1442816, 1444864, 1445888, 1446912, 1447936,
+	1449984, 1451008, 1452032, 1453056, 1455104, 1456128, 1457152, 1458176, 1460224, 1461248, 1463296, 1464320, 1465344, 1466368, 1468416, 1469440,
+	1471488, 1472512, 1473536, 1474560, 1476608, 1477632, 1478656, 1479680, 1481728, 1482752, 1483776, 1484800, 1486848, 1487872, 1488896, 1489920,
+	1492992, 1494016, 1495040, 1496064, 1498112, 1499136, 1500160, 1501184, 1503232, 1504256, 1506304, 1507328, 1508352, 1509376, 1511424, 1512448,
+	1514496, 1515520, 1516544, 1517568, 1519616, 1520640, 1521664, 1522688, 1524736, 1525760, 1527808, 1528832, 1529856, 1530880, 1532928, 1533952,
+	1537024, 1538048, 1539072, 1540096, 1542144, 1543168, 1545216, 1546240, 1548288, 1549312, 1550336, 1551360, 1553408, 1554432, 1556480, 1557504,
+	1559552, 1560576, 1561600, 1562624, 1564672, 1565696, 1567744, 1568768, 1570816, 1571840, 1572864, 1573888, 1575936, 1576960, 1579008, 1580032,
+	1582080, 1583104, 1584128, 1585152, 1587200, 1588224, 1590272, 1591296, 1593344, 1594368, 1595392, 1596416, 1598464, 1599488, 1601536, 1602560,
+	1604608, 1605632, 1606656, 1607680, 1609728, 1610752, 1612800, 1613824, 1615872, 1616896, 1617920, 1618944, 1620992, 1622016, 1624064, 1625088,
+	1628160, 1629184, 1630208, 1631232, 1633280, 1634304, 1636352, 1637376, 1639424, 1640448, 1642496, 1643520, 1645568, 1646592, 1647616, 1648640,
+	1651712, 1652736, 1653760, 1654784, 1656832, 1657856, 1659904, 1660928, 1662976, 1664000, 1666048, 1667072, 1669120, 1670144, 1671168, 1672192,
+	1676288, 1677312, 1678336, 1679360, 1681408, 1682432, 1684480, 1685504, 1687552, 1688576, 1690624, 1691648, 1693696, 1694720, 1695744, 1696768,
+	1699840, 1700864, 1702912, 1703936, 1705984, 1707008, 1709056, 1710080, 1712128, 1713152, 1715200, 1716224, 1718272, 1719296, 1721344, 1722368,
+	1725440, 1726464, 1728512, 1729536, 1731584, 1732608, 1734656, 1735680, 1737728, 1738752, 1740800, 1741824, 1743872, 1744896, 1746944, 1747968,
+	1750016, 1751040, 1753088, 1754112, 1756160, 1757184, 1759232, 1760256, 1762304, 1763328, 1765376, 1766400, 1768448, 1769472, 1771520, 1772544,
+	1775616, 1776640, 1778688, 1779712, 1781760, 1782784, 1784832, 1785856, 1787904, 1789952, 1790976, 1793024, 1794048, 1796096, 1797120, 1799168,
+	1801216, 1802240, 1804288, 1805312, 1807360, 1808384, 1810432, 1811456, 1813504, 1815552, 1816576, 1818624, 1819648, 1821696, 1822720, 1824768,
+	1827840, 1828864, 1830912, 1831936, 1833984, 1836032, 1837056, 1839104, 1841152, 1842176, 1844224, 1845248, 1847296, 1849344, 1850368, 1852416,
+	1854464, 1855488, 1857536, 1858560, 1860608, 1862656, 1863680, 1865728, 1867776, 1868800, 1870848, 1871872, 1873920, 1875968, 1876992, 1879040,
+	1881088, 1882112, 1884160, 1885184, 1887232, 1889280, 1890304, 1892352, 1894400, 1895424, 1897472, 1898496, 1900544, 1902592, 1903616, 1905664,
+	1908736, 1909760, 1911808, 1912832, 1914880, 1916928, 1917952, 1920000, 1922048, 1924096, 1925120, 1927168, 1929216, 1930240, 1932288, 1933312,
+	1936384, 1937408, 1939456, 1940480, 1942528, 1944576, 1945600, 1947648, 1949696, 1951744, 1952768, 1954816, 1956864, 1957888, 1959936, 1960960,
+	1964032, 1965056, 1967104, 1969152, 1971200, 1972224, 1974272, 1976320, 1978368, 1979392, 1981440, 1983488, 1985536, 1986560, 1988608, 1990656,
+	1992704, 1993728, 1995776, 1997824, 1999872, 2000896, 2002944, 2004992, 2007040, 2008064, 2010112, 2012160, 2014208, 2015232, 2017280, 2019328,
+	2022400, 2023424, 2025472, 2027520, 2029568, 2030592, 2032640, 2034688, 2036736, 2037760, 2039808, 2041856, 2043904, 2044928, 2046976, 2049024,
+	2051072, 2052096, 2054144, 2056192, 2058240, 2059264, 2061312, 2063360, 2065408, 2067456, 2069504, 2070528, 2072576, 2074624, 2076672, 2077696,
+	2080768, 2081792, 2083840, 2085888, 2087936, 2089984, 2092032, 2093056, 2096128, 2097152, 2099200, 2101248, 2103296, 2105344, 2107392, 2108416,
+	2111488, 2112512, 2114560, 2116608, 2118656, 2120704, 2122752, 2123776, 2126848, 2127872, 2129920, 2131968, 2134016, 2136064, 2138112, 2139136,
+	2142208, 2143232, 2145280, 2147328, 2149376, 2151424, 2153472, 2154496, 2157568, 2158592, 2160640, 2162688, 2164736, 2166784, 2168832, 2169856,
+	2172928, 2173952, 2176000, 2178048, 2180096, 2182144, 2184192, 2185216, 2188288, 2190336, 2192384, 2193408, 2196480, 2197504, 2199552, 2201600,
+	2204672, 2205696, 2207744, 2209792, 2211840, 2213888, 2215936, 2216960, 2220032, 2222080, 2224128, 2225152, 2228224, 2229248, 2231296, 2233344,
+	2237440, 2238464, 2240512, 2242560, 2244608, 2246656, 2248704, 2249728, 2252800, 2254848, 2256896, 2257920, 2260992, 2262016, 2264064, 2266112,
+	2269184, 2271232, 2273280, 2275328, 2276352, 2279424, 2280448, 2283520, 2285568, 2287616, 2289664, 2291712, 2292736, 2295808, 2296832, 2299904,
+	2302976, 2305024, 2307072, 2309120, 2310144, 2313216, 2314240, 2317312, 2319360, 2321408, 2323456, 2325504, 2326528, 2329600, 2330624, 2333696,
+	2335744, 2337792, 2339840, 2341888, 2342912, 2345984, 2347008, 2350080, 2352128, 2354176, 2356224, 2358272, 2359296, 2362368, 2363392, 2366464,
+	2370560, 2372608, 2374656, 2376704, 2377728, 2380800, 2381824, 2384896, 2386944, 2388992, 2391040, 2393088, 2394112, 2397184, 2398208, 2401280,
+	2404352, 2406400, 2408448, 2410496, 2411520, 2414592, 2415616, 2418688, 2420736, 2422784, 2424832, 2426880, 2427904, 2430976, 2432000, 2435072,
+	2439168, 2441216, 2443264, 2445312, 2446336, 2449408, 2450432, 2453504, 2455552, 2457600, 2459648, 2461696, 2464768, 2467840, 2468864, 2471936,
+	2475008, 2477056, 2479104, 2481152, 2482176, 2485248, 2486272, 2489344, 2491392, 2493440, 2495488, 2497536, 2500608, 2503680, 2504704, 2507776,
+	2510848, 2512896, 2514944, 2516992, 2518016, 2521088, 2522112, 2525184, 2527232, 2529280, 2531328, 2533376, 2536448, 2539520, 2540544, 2543616,
+	2547712, 2549760, 2551808, 2553856, 2554880, 2557952, 2558976, 2562048, 2564096, 2566144, 2568192, 2570240, 2573312, 2576384, 2577408, 2580480,
+	2584576, 2586624, 2588672, 2590720, 2591744, 2594816, 2595840, 2598912, 2600960, 2603008, 2605056, 2607104, 2610176, 2613248, 2614272, 2617344,
+	2622464, 2624512, 2626560, 2628608, 2629632, 2632704, 2633728, 2636800, 2638848, 2640896, 2642944, 2644992, 2648064, 2651136, 2652160, 2655232,
+	2660352, 2662400, 2664448, 2666496, 2668544, 2670592, 2672640, 2674688, 2678784, 2680832, 2682880, 2684928, 2689024, 2691072, 2693120, 2695168,
+	2699264, 2701312, 2703360, 2705408, 2707456, 2709504, 2711552, 2713600, 2717696, 2719744, 2721792, 2723840, 2727936, 2729984, 2732032, 2734080,
+	2738176, 2740224, 2742272, 2744320, 2746368, 2748416, 2750464, 2752512, 2756608, 2758656, 2760704, 2762752, 2766848, 2768896, 2770944, 2772992,
+	2777088, 2779136, 2781184, 2783232, 2787328, 2789376, 2791424, 2793472, 2797568, 2799616, 2801664, 2803712, 2807808, 2809856, 2811904, 2813952,
+	2818048, 2820096, 2822144, 2824192, 2828288, 2830336, 2832384, 2834432, 2838528, 2840576, 2842624, 2844672, 2848768, 2850816, 2852864, 2854912,
+	2859008, 2861056, 2863104, 2865152, 2869248, 2871296, 2873344, 2875392, 2879488, 2881536, 2883584, 2885632, 2889728, 2891776, 2893824, 2895872,
+	2899968, 2902016, 2904064, 2906112, 2910208, 2912256, 2914304, 2916352, 2920448, 2922496, 2926592, 2928640, 2930688, 2932736, 2936832, 2938880,
+	2942976, 2945024, 2947072, 2949120, 2953216, 2955264, 2957312, 2959360, 2963456, 2965504, 2967552, 2969600, 2973696, 2975744, 2977792, 2979840,
+	2985984, 2988032, 2990080, 2992128, 2996224, 2998272, 3000320, 3002368, 3006464, 3008512, 3012608, 3014656, 3016704, 3018752, 3022848, 3024896,
+	3028992, 3031040, 3033088, 3035136, 3039232, 3041280, 3043328, 3045376, 3049472, 3051520, 3055616, 3057664, 3059712, 3061760, 3065856, 3067904,
+	3074048, 3076096, 3078144, 3080192, 3084288, 3086336, 3090432, 3092480, 3096576, 3098624, 3100672, 3102720, 3106816, 3108864, 3112960, 3115008,
+	3119104, 3121152, 3123200, 3125248, 3129344, 3131392, 3135488, 3137536, 3141632, 3143680, 3145728, 3147776, 3151872, 3153920, 3158016, 3160064,
+	3164160, 3166208, 3168256, 3170304, 3174400, 3176448, 3180544, 3182592, 3186688, 3188736, 3190784, 3192832, 3196928, 3198976, 3203072, 3205120,
+	3209216, 3211264, 3213312, 3215360, 3219456, 3221504, 3225600, 3227648, 3231744, 3233792, 3235840, 3237888, 3241984, 3244032, 3248128, 3250176,
+	3256320, 3258368, 3260416, 3262464, 3266560, 3268608, 3272704, 3274752, 3278848, 3280896, 3284992, 3287040, 3291136, 3293184, 3295232, 3297280,
+	3303424, 3305472, 3307520, 3309568, 3313664, 3315712, 3319808, 3321856, 3325952, 3328000, 3332096, 3334144, 3338240, 3340288, 3342336, 3344384,
+	3352576, 3354624, 3356672, 3358720, 3362816, 3364864, 3368960, 3371008, 3375104, 3377152, 3381248, 3383296, 3387392, 3389440, 3391488, 3393536,
+	3399680, 3401728, 3405824, 3407872, 3411968, 3414016, 3418112, 3420160, 3424256, 3426304, 3430400, 3432448, 3436544, 3438592, 3442688, 3444736,
+	3450880, 3452928, 3457024, 3459072, 3463168, 3465216, 3469312, 3471360, 3475456, 3477504, 3481600, 3483648, 3487744, 3489792, 3493888, 3495936,
+	3500032, 3502080, 3506176, 3508224, 3512320, 3514368, 3518464, 3520512, 3524608, 3526656, 3530752, 3532800, 3536896, 3538944, 3543040, 3545088,
+	3551232, 3553280, 3557376, 3559424, 3563520, 3565568, 3569664, 3571712, 3575808, 3579904, 3581952, 3586048, 3588096, 3592192, 3594240, 3598336,
+	3602432, 3604480, 3608576, 3610624, 3614720, 3616768, 3620864, 3622912, 3627008, 3631104, 3633152, 3637248, 3639296, 3643392, 3645440, 3649536,
+	3655680, 3657728, 3661824, 3663872, 3667968, 3672064, 3674112, 3678208, 3682304, 3684352, 3688448, 3690496, 3694592, 3698688, 3700736, 3704832,
+	3708928, 3710976, 3715072, 3717120, 3721216, 3725312, 3727360, 3731456, 3735552, 3737600, 3741696, 3743744, 3747840, 3751936, 3753984, 3758080,
+	3762176, 3764224, 3768320, 3770368, 3774464, 3778560, 3780608, 3784704, 3788800, 3790848, 3794944, 3796992, 3801088, 3805184, 3807232, 3811328,
+	3817472, 3819520, 3823616, 3825664, 3829760, 3833856, 3835904, 3840000, 3844096, 3848192, 3850240, 3854336, 3858432, 3860480, 3864576, 3866624,
+	3872768, 3874816, 3878912, 3880960, 3885056, 3889152, 3891200, 3895296, 3899392, 3903488, 3905536, 3909632, 3913728, 3915776, 3919872, 3921920,
+	3928064, 3930112, 3934208, 3938304, 3942400, 3944448, 3948544, 3952640, 3956736, 3958784, 3962880, 3966976, 3971072, 3973120, 3977216, 3981312,
+	3985408, 3987456, 3991552, 3995648, 3999744, 4001792, 4005888, 4009984, 4014080, 4016128, 4020224, 4024320, 4028416, 4030464, 4034560, 4038656,
+	4044800, 4046848, 4050944, 4055040, 4059136, 4061184, 4065280, 4069376, 4073472, 4075520, 4079616, 4083712, 4087808, 4089856, 4093952, 4098048,
+	4102144, 4104192, 4108288, 4112384, 4116480, 4118528, 4122624, 4126720, 4130816, 4134912, 4139008, 4141056, 4145152, 4149248, 4153344, 4155392,
+	4161536, 4163584, 4167680, 4171776, 4175872, 4179968, 4184064, 4186112, 4192256, 4194304, 4198400, 4202496, 4206592, 4210688, 4214784, 4216832,
+	4222976, 4225024, 4229120, 4233216, 4237312, 4241408, 4245504, 4247552, 4253696, 4255744, 4259840, 4263936, 4268032, 4272128, 4276224, 4278272,
+	4284416, 4286464, 4290560, 4294656, 4298752, 4302848, 4306944, 4308992, 4315136, 4317184, 4321280, 4325376, 4329472, 4333568, 4337664, 4339712,
+	4345856, 4347904, 4352000, 4356096, 4360192, 4364288, 4368384, 4370432, 4376576, 4380672, 4384768, 4386816, 4392960, 4395008, 4399104, 4403200,
+	4409344, 4411392, 4415488, 4419584, 4423680, 4427776, 4431872, 4433920, 4440064, 4444160, 4448256, 4450304, 4456448, 4458496, 4462592, 4466688,
+	4474880, 4476928, 4481024, 4485120, 4489216, 4493312, 4497408, 4499456, 4505600, 4509696, 4513792, 4515840, 4521984, 4524032, 4528128, 4532224,
+	4538368, 4542464, 4546560, 4550656, 4552704, 4558848, 4560896, 4567040, 4571136, 4575232, 4579328, 4583424, 4585472, 4591616, 4593664, 4599808,
+	4605952, 4610048, 4614144, 4618240, 4620288, 4626432, 4628480, 4634624, 4638720, 4642816, 4646912, 4651008, 4653056, 4659200, 4661248, 4667392,
+	4671488, 4675584, 4679680, 4683776, 4685824, 4691968, 4694016, 4700160, 4704256, 4708352, 4712448, 4716544, 4718592, 4724736, 4726784, 4732928,
+	4741120, 4745216, 4749312, 4753408, 4755456, 4761600, 4763648, 4769792, 4773888, 4777984, 4782080, 4786176, 4788224, 4794368, 4796416, 4802560,
+	4808704, 4812800, 4816896, 4820992, 4823040, 4829184, 4831232, 4837376, 4841472, 4845568, 4849664, 4853760, 4855808, 4861952, 4864000, 4870144,
+	4878336, 4882432, 4886528, 4890624, 4892672, 4898816, 4900864, 4907008, 4911104, 4915200, 4919296, 4923392, 4929536, 4935680, 4937728, 4943872,
+	4950016, 4954112, 4958208, 4962304, 4964352, 4970496, 4972544, 4978688, 4982784, 4986880, 4990976, 4995072, 5001216, 5007360, 5009408, 5015552,
+	5021696, 5025792, 5029888, 5033984, 5036032, 5042176, 5044224, 5050368, 5054464, 5058560, 5062656, 5066752, 5072896, 5079040, 5081088, 5087232,
+	5095424, 5099520, 5103616, 5107712, 5109760, 5115904, 5117952, 5124096, 5128192, 5132288, 5136384, 5140480, 5146624, 5152768, 5154816, 5160960,
+	5169152, 5173248, 5177344, 5181440, 5183488, 5189632, 5191680, 5197824, 5201920, 5206016, 5210112, 5214208, 5220352, 5226496, 5228544, 5234688,
+	5244928, 5249024, 5253120, 5257216, 5259264, 5265408, 5267456, 5273600, 5277696, 5281792, 5285888, 5289984, 5296128, 5302272, 5304320, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+	5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464, 5310464,
+};
+
+static const int32_t dt1_freq[8*32] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 128, 128, 128, 128,
+	128, 192, 192, 192, 256, 256, 256, 320, 320, 384, 384, 448, 512, 512, 512, 512,
+	64, 64, 64, 64, 128, 128, 128, 128, 128, 192, 192, 192, 256, 256, 256, 320,
+	320, 384, 384, 448, 512, 512, 576, 640, 704, 768, 832, 896, 1024, 1024, 1024, 1024,
+	128, 128, 128, 128, 128, 192, 192, 192, 256, 256, 256, 320, 320, 384, 384, 448,
+	512, 512, 576, 640, 704, 768, 832, 896, 1024, 1088, 1216, 1280, 1408, 1408, 1408, 1408,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, -64, -64, -64, -64, -64, -64, -64, -64, -128, -128, -128, -128,
+	-128, -192, -192, -192, -256, -256, -256, -320, -320, -384, -384, -448, -512, -512, -512, -512,
+	-64, -64, -64, -64, -128, -128, -128, -128, -128, -192, -192, -192, -256, -256, -256, -320,
+	-320, -384, -384, -448, -512, -512, -576, -640, -704, -768, -832, -896, -1024, -1024, -1024, -1024,
+	-128, -128, -128, -128, -128, -192, -192, -192, -256, -256, -256, -320, -320, -384, -384, -448,
+	-512, -512, -576, -640, -704, -768, -832, -896, -1024, -1088, -1216, -1280, -1408, -1408, -1408, -1408,
+};
+
+static const uint32_t noise_tab[32] = {
+	4096, 4224, 4352, 4480, 4672, 4800, 4992, 5184, 5440, 5696, 5952, 6208, 6528, 6848, 7232, 7680,
+	8192, 8704, 9344, 10048, 10880, 11904, 13056, 14528, 16384, 18688, 21824, 26176, 32768, 43648, 65536, 65536,
+};
+
+static const int tl_tab[YM2151_TL_TAB_LEN] = {
+	8168, -8168, 8148, -8148, 8124, -8124, 8104, -8104, 8080, -8080, 8060, -8060, 8040, -8040, 8016, -8016,
+	7996, -7996, 7972, -7972, 7952, -7952, 7932, -7932, 7908, -7908, 7888, -7888, 7864, -7864, 7844, -7844,
+	7824, -7824, 7804, -7804, 7780, -7780, 7760, -7760, 7740, -7740, 7720, -7720, 7696, -7696, 7676, -7676,
+	7656, -7656, 7636, -7636, 7616, -7616, 7592, -7592, 7572, -7572, 7552, -7552, 7532, -7532, 7512, -7512,
+	7492, -7492, 7472, -7472, 7452, -7452, 7432, -7432, 7412, -7412, 7392, -7392, 7372, -7372, 7352, -7352,
+	7332, -7332, 7312, -7312, 7292, -7292, 7272, -7272, 7252, -7252, 7232, -7232, 7212, -7212, 7192, -7192,
+	7176, -7176, 7156, -7156, 7136, -7136, 7116, -7116, 7096, -7096, 7076, -7076, 7060, -7060, 7040, -7040,
+	7020, -7020, 7000, -7000, 6984, -6984, 6964, -6964, 6944, -6944, 6928, -6928, 6908, -6908, 6888, -6888,
+	6868, -6868, 6852, -6852, 6832, -6832, 6816, -6816, 6796, -6796, 6776, -6776, 6760, -6760, 6740, -6740,
+	6724, -6724, 6704, -6704, 6688, -6688, 6668, -6668, 6652, -6652, 6632, -6632, 6616, -6616, 6596, -6596,
+	6580, -6580, 6560, -6560, 6544, -6544, 6524, -6524, 6508, -6508, 6492, -6492, 6472, -6472, 6456, -6456,
+	6436, -6436, 6420, -6420, 6404, -6404, 6384, -6384, 6368, -6368, 6352, -6352, 6336, -6336, 6316, -6316,
+	6300, -6300, 6284, -6284, 6264, -6264, 6248, -6248, 6232, -6232, 6216, -6216, 6200, -6200, 6180, -6180,
+	6164, -6164, 6148, -6148, 6132, -6132, 6116, -6116, 6100, -6100, 6080, -6080, 6064, -6064, 6048, -6048,
+	6032, -6032, 6016, -6016, 6000, -6000, 5984, -5984, 5968, -5968, 5952, -5952, 5936, -5936, 5920, -5920,
+	5904, -5904, 5888, -5888, 5872, -5872, 5856, -5856, 5840, -5840, 5824, -5824, 5808, -5808, 5792, -5792,
+	5776, -5776, 5760, -5760, 5744, -5744, 5732, -5732, 5716, -5716, 5700, -5700, 5684, -5684, 5668, -5668,
+	5652, -5652, 5636, -5636, 5624, -5624, 5608, -5608, 5592, -5592, 5576, -5576, 5564, -5564, 5548, -5548,
+	5532, -5532, 5516, -5516, 5504, -5504, 5488, -5488, 5472, -5472, 5456, -5456, 5444, -5444, 5428, -5428,
+	5412, -5412, 5400, -5400, 5384, -5384, 5368, -5368, 5356, -5356, 5340, -5340, 5328, -5328, 5312, -5312,
+	5296, -5296, 5284, -5284, 5268, -5268, 5256, -5256, 5240, -5240, 5228, -5228, 5212, -5212, 5200, -5200,
+	5184, -5184, 5168, -5168, 5156, -5156, 5144, -5144, 5128, -5128, 5116, -5116, 5100, -5100, 5088, -5088,
+	5072, -5072, 5060, -5060, 5044, -5044, 5032, -5032, 5020, -5020, 5004, -5004, 4992, -4992, 4976, -4976,
+	4964, -4964, 4952, -4952, 4936, -4936, 4924, -4924, 4912, -4912, 4896, -4896, 4884, -4884, 4872, -4872,
+	4856, -4856, 4844, -4844, 4832, -4832, 4820, -4820, 4804, -4804, 4792, -4792, 4780, -4780, 4768, -4768,
+	4752, -4752, 4740, -4740, 4728, -4728, 4716, -4716, 4704, -4704, 4688, -4688, 4676, -4676, 4664, -4664,
+	4652, -4652, 4640, -4640, 4628, -4628, 4616, -4616, 4600, -4600, 4588, -4588, 4576, -4576, 4564, -4564,
+	4552, -4552, 4540, -4540, 4528, -4528, 4516, -4516, 4504, -4504, 4492, -4492, 4480, -4480, 4468, -4468,
+	4456, -4456, 4444, -4444, 4432, -4432, 4420, -4420, 4408, -4408, 4396, -4396, 4384, -4384, 4372, -4372,
+	4360, -4360, 4348, -4348, 4336, -4336, 4324, -4324, 4312, -4312, 4300, -4300, 4288, -4288, 4276, -4276,
+	4264, -4264, 4256, -4256, 4244, -4244, 4232, -4232, 4220, -4220, 4208, -4208, 4196, -4196, 4184, -4184,
+	4176, -4176, 4164, -4164, 4152, -4152, 4140, -4140, 4128, -4128, 4120, -4120, 4108, -4108, 4096, -4096,
+	4084, -4084, 4074, -4074, 4062, -4062, 4052, -4052, 4040, -4040, 4030, -4030, 4020, -4020, 4008, -4008,
+	3998, -3998, 3986, -3986, 3976, -3976, 3966, -3966, 3954, -3954, 3944, -3944, 3932, -3932, 3922, -3922,
+	3912, -3912, 3902, -3902, 3890, -3890, 3880, -3880, 3870, -3870, 3860, -3860, 3848, -3848, 3838, -3838,
+	3828, -3828, 3818, -3818, 3808, -3808, 3796, -3796, 3786, -3786, 3776, -3776, 3766, -3766, 3756, -3756,
+	3746, -3746, 3736, -3736, 3726, -3726, 3716, -3716, 3706, -3706, 3696, -3696, 3686, -3686, 3676, -3676,
+	3666, -3666, 3656, -3656, 3646, -3646, 3636, -3636, 3626, -3626, 3616, -3616, 3606, -3606, 3596, -3596,
+	3588, -3588, 3578, -3578, 3568, -3568, 3558, -3558, 3548, -3548, 3538, -3538, 3530, -3530, 3520, -3520,
+	3510, -3510, 3500, -3500, 3492, -3492, 3482, -3482, 3472, -3472, 3464, -3464, 3454, -3454, 3444, -3444,
+	3434, -3434, 3426, -3426, 3416, -3416, 3408, -3408, 3398, -3398, 3388, -3388, 3380, -3380, 3370, -3370,
+	3362, -3362, 3352, -3352, 3344, -3344, 3334, -3334, 3326, -3326, 3316, -3316, 3308, -3308, 3298, -3298,
+	3290, -3290, 3280, -3280, 3272, -3272, 3262, -3262, 3254, -3254, 3246, -3246, 3236, -3236, 3228, -3228,
+	3218, -3218, 3210, -3210, 3202, -3202, 3192, -3192, 3184, -3184, 3176, -3176, 3168, -3168, 3158, -3158,
+	3150, -3150, 3142, -3142, 3132, -3132, 3124, -3124, 3116, -3116, 3108, -3108, 3100, -3100, 3090, -3090,
+	3082, -3082, 3074, -3074, 3066, -3066, 3058, -3058, 3050, -3050, 3040, -3040, 3032, -3032, 3024, -3024,
+	3016, -3016, 3008, -3008, 3000, -3000, 2992, -2992, 2984, -2984, 2976, -2976, 2968, -2968, 2960, -2960,
+	2952, -2952, 2944, -2944, 2936, -2936, 2928, -2928, 2920, -2920, 2912, -2912, 2904, -2904, 2896, -2896,
+	2888, -2888, 2880, -2880, 2872, -2872, 2866, -2866, 2858, -2858, 2850, -2850, 2842, -2842, 2834, -2834,
+	2826, -2826, 2818, -2818, 2812, -2812, 2804, -2804, 2796, -2796, 2788, -2788, 2782, -2782, 2774, -2774,
+	2766, -2766, 2758, -2758, 2752, -2752, 2744, -2744, 2736, -2736, 2728, -2728, 2722, -2722, 2714, -2714,
+	2706, -2706, 2700, -2700, 2692, -2692, 2684, -2684, 2678, -2678, 2670, -2670, 2664, -2664, 2656, -2656,
+	2648, -2648, 2642, -2642, 2634, -2634, 2628, -2628, 2620, -2620, 2614, -2614, 2606, -2606, 2600, -2600,
+	2592, -2592, 2584, -2584, 2578, -2578, 2572, -2572, 2564, -2564, 2558, -2558, 2550, -2550, 2544, -2544,
+	2536, -2536, 2530, -2530, 2522, -2522, 2516, -2516, 2510, -2510, 2502, -2502, 2496, -2496, 2488, -2488,
+	2482, -2482, 2476, -2476, 2468, -2468, 2462, -2462, 2456, -2456, 2448, -2448, 2442, -2442, 2436, -2436,
+	2428, -2428, 2422, -2422, 2416, -2416, 2410, -2410, 2402, -2402, 2396, -2396, 2390, -2390, 2384, -2384,
+	2376, -2376, 2370, -2370, 2364, -2364, 2358, -2358, 2352, -2352, 2344, -2344, 2338, -2338, 2332, -2332,
+	2326, -2326, 2320, -2320, 2314, -2314, 2308, -2308, 2300, -2300, 2294, -2294, 2288, -2288, 2282, -2282,
+	2276, -2276, 2270, -2270, 2264, -2264, 2258, -2258, 2252, -2252, 2246, -2246, 2240, -2240, 2234, -2234,
+	2228, -2228, 2222, -2222, 2216, -2216, 2210, -2210, 2204, -2204, 2198, -2198, 2192, -2192, 2186, -2186,
+	2180, -2180, 2174, -2174, 2168, -2168, 2162, -2162, 2156, -2156, 2150, -2150, 2144, -2144, 2138, -2138,
+	2132, -2132, 2128, -2128, 2122, -2122, 2116, -2116, 2110, -2110, 2104, -2104, 2098, -2098, 2092, -2092,
+	2088, -2088, 2082, -2082, 2076, -2076, 2070, -2070, 2064, -2064, 2060, -2060, 2054, -2054, 2048, -2048,
+	2042, -2042, 2037, -2037, 2031, -2031, 2026, -2026, 2020, -2020, 2015, -2015, 2010, -2010, 2004, -2004,
+	1999, -1999, 1993, -1993, 1988, -1988, 1983, -1983, 1977, -1977, 1972, -1972, 1966, -1966, 1961, -1961,
+	1956, -1956, 1951, -1951, 1945, -1945, 1940, -1940, 1935, -1935, 1930, -1930, 1924, -1924, 1919, -1919,
+	1914, -1914, 1909, -1909, 1904, -1904, 1898, -1898, 1893, -1893, 1888, -1888, 1883, -1883, 1878, -1878,
+	1873, -1873, 1868, -1868, 1863, -1863, 1858, -1858, 1853, -1853, 1848, -1848, 1843, -1843, 1838, -1838,
+	1833, -1833, 1828, -1828, 1823, -1823, 1818, -1818, 1813, -1813, 1808, -1808, 1803, -1803, 1798, -1798,
+	1794, -1794, 1789, -1789, 1784, -1784, 1779, -1779, 1774, -1774, 1769, -1769, 1765, -1765, 1760, -1760,
+	1755, -1755, 1750, -1750, 1746, -1746, 1741, -1741, 1736, -1736, 1732, -1732, 1727, -1727, 1722, -1722,
+	1717, -1717, 1713, -1713, 1708, -1708, 1704, -1704, 1699, -1699, 1694, -1694, 1690, -1690, 1685, -1685,
+	1681, -1681, 1676, -1676, 1672, -1672, 1667, -1667, 1663, -1663, 1658, -1658, 1654, -1654, 1649, -1649,
+	1645, -1645, 1640, -1640, 1636, -1636, 1631, -1631, 1627, -1627, 1623, -1623, 1618, -1618, 1614, -1614,
+	1609, -1609, 1605, -1605, 1601, -1601, 1596, -1596, 1592, -1592, 1588, -1588, 1584, -1584, 1579, -1579,
+	1575, -1575, 1571, -1571, 1566, -1566, 1562, -1562, 1558, -1558, 1554, -1554, 1550, -1550, 1545, -1545,
+	1541, -1541, 1537, -1537, 1533, -1533, 1529, -1529, 1525, -1525, 1520, -1520, 1516, -1516, 1512, -1512,
+	1508, -1508, 1504, -1504, 1500, -1500, 1496, -1496, 1492, -1492, 1488, -1488, 1484, -1484, 1480, -1480,
+	1476, -1476, 1472, -1472, 1468, -1468, 1464, -1464, 1460, -1460, 1456, -1456, 1452, -1452, 1448, -1448,
+	1444, -1444, 1440, -1440, 1436, -1436, 1433, -1433, 1429, -1429, 1425, -1425, 1421, -1421, 1417, -1417,
+	1413, -1413, 1409, -1409, 1406, -1406, 1402, -1402, 1398, -1398, 1394, -1394, 1391, -1391, 1387, -1387,
+	1383, -1383, 1379, -1379, 1376, -1376, 1372, -1372, 1368, -1368, 1364, -1364, 1361, -1361, 1357, -1357,
+	1353, -1353, 1350, -1350, 1346, -1346, 1342, -1342, 1339, -1339, 1335, -1335, 1332, -1332, 1328, -1328,
+	1324, -1324, 1321, -1321, 1317, -1317, 1314, -1314, 1310, -1310, 1307, -1307, 1303, -1303, 1300, -1300,
+	1296, -1296, 1292, -1292, 1289, -1289, 1286, -1286, 1282, -1282, 1279, -1279, 1275, -1275, 1272, -1272,
+	1268, -1268, 1265, -1265, 1261, -1261, 1258, -1258, 1255, -1255, 1251, -1251, 1248, -1248, 1244, -1244,
+	1241, -1241, 1238, -1238, 1234, -1234, 1231, -1231, 1228, -1228, 1224, -1224, 1221, -1221, 1218, -1218,
+	1214, -1214, 1211, -1211, 1208, -1208, 1205, -1205, 1201, -1201, 1198, -1198, 1195, -1195, 1192, -1192,
+	1188, -1188, 1185, -1185, 1182, -1182, 1179, -1179, 1176, -1176, 1172, -1172, 1169, -1169, 1166, -1166,
+	1163, -1163, 1160, -1160, 1157, -1157, 1154, -1154, 1150, -1150, 1147, -1147, 1144, -1144, 1141, -1141,
+	1138, -1138, 1135, -1135, 1132, -1132, 1129, -1129, 1126, -1126, 1123, -1123, 1120, -1120, 1117, -1117,
+	1114, -1114, 1111, -1111, 1108, -1108, 1105, -1105, 1102, -1102, 1099, -1099, 1096, -1096, 1093, -1093,
+	1090, -1090, 1087, -1087, 1084, -1084, 1081, -1081, 1078, -1078, 1075, -1075, 1072, -1072, 1069, -1069,
+	1066, -1066, 1064, -1064, 1061, -1061, 1058, -1058, 1055, -1055, 1052, -1052, 1049, -1049, 1046, -1046,
+	1044, -1044, 1041, -1041, 1038, -1038, 1035, -1035, 1032, -1032, 1030, -1030, 1027, -1027, 1024, -1024,
+	1021, -1021, 1018, -1018, 1015, -1015, 1013, -1013, 1010, -1010, 1007, -1007, 1005, -1005, 1002, -1002,
+	999, -999, 996, -996, 994, -994, 991, -991, 988, -988, 986, -986, 983, -983, 980, -980,
+	978, -978, 975, -975, 972, -972, 970, -970, 967, -967, 965, -965, 962, -962, 959, -959,
+	957, -957, 954, -954, 952, -952, 949, -949, 946, -946, 944, -944, 941, -941, 939, -939,
+	936, -936, 934, -934, 931, -931, 929, -929, 926, -926, 924, -924, 921, -921, 919, -919,
+	916, -916, 914, -914, 911, -911, 909, -909, 906, -906, 904, -904, 901, -901, 899, -899,
+	897, -897, 894, -894, 892, -892, 889, -889, 887, -887, 884, -884, 882, -882, 880, -880,
+	877, -877, 875, -875, 873, -873, 870, -870, 868, -868, 866, -866, 863, -863, 861, -861,
+	858, -858, 856, -856, 854, -854, 852, -852, 849, -849, 847, -847, 845, -845, 842, -842,
+	840, -840, 838, -838, 836, -836, 833, -833, 831, -831, 829, -829, 827, -827, 824, -824,
+	822, -822, 820, -820, 818, -818, 815, -815, 813, -813, 811, -811, 809, -809, 807, -807,
+	804, -804, 802, -802, 800, -800, 798, -798, 796, -796, 794, -794, 792, -792, 789, -789,
+	787, -787, 785, -785, 783, -783, 781, -781, 779, -779, 777, -777, 775, -775, 772, -772,
+	770, -770, 768, -768, 766, -766, 764, -764, 762, -762, 760, -760, 758, -758, 756, -756,
+	754, -754, 752, -752, 750, -750, 748, -748, 746, -746, 744, -744, 742, -742, 740, -740,
+	738, -738, 736, -736, 734, -734, 732, -732, 730, -730, 728, -728, 726, -726, 724, -724,
+	722, -722, 720, -720, 718, -718, 716, -716, 714, -714, 712, -712, 710, -710, 708, -708,
+	706, -706, 704, -704, 703, -703, 701, -701, 699, -699, 697, -697, 695, -695, 693, -693,
+	691, -691, 689, -689, 688, -688, 686, -686, 684, -684, 682, -682, 680, -680, 678, -678,
+	676, -676, 675, -675, 673, -673, 671, -671, 669, -669, 667, -667, 666, -666, 664, -664,
+	662, -662, 660, -660, 658, -658, 657, -657, 655, -655, 653, -653, 651, -651, 650, -650,
+	648, -648, 646, -646, 644, -644, 643, -643, 641, -641, 639, -639, 637, -637, 636, -636,
+	634, -634, 632, -632, 630, -630, 629, -629, 627, -627, 625, -625, 624, -624, 622, -622,
+	620, -620, 619, -619, 617, -617, 615, -615, 614, -614, 612, -612, 610, -610, 609, -609,
+	607, -607, 605, -605, 604, -604, 602, -602, 600, -600, 599, -599, 597, -597, 596, -596,
+	594, -594, 592, -592, 591, -591, 589, -589, 588, -588, 586, -586, 584, -584, 583, -583,
+	581, -581, 580, -580, 578, -578, 577, -577, 575, -575, 573, -573, 572, -572, 570, -570,
+	569, -569, 567, -567, 566, -566, 564, -564, 563, -563, 561, -561, 560, -560, 558, -558,
+	557, -557, 555, -555, 554, -554, 552, -552, 551, -551, 549, -549, 548, -548, 546, -546,
+	545, -545, 543, -543, 542, -542, 540, -540, 539, -539, 537, -537, 536, -536, 534, -534,
+	533, -533, 532, -532, 530, -530, 529, -529, 527, -527, 526, -526, 524, -524, 523, -523,
+	522, -522, 520, -520, 519, -519, 517, -517, 516, -516, 515, -515, 513, -513, 512, -512,
+	510, -510, 509, -509, 507, -507, 506, -506, 505, -505, 503, -503, 502, -502, 501, -501,
+	499, -499, 498, -498, 497, -497, 495, -495, 494, -494, 493, -493, 491, -491, 490, -490,
+	489, -489, 487, -487, 486, -486, 485, -485, 483, -483, 482, -482, 481, -481, 479, -479,
+	478, -478, 477, -477, 476, -476, 474, -474, 473, -473, 472, -472, 470, -470, 469, -469,
+	468, -468, 467, -467, 465, -465, 464, -464, 463, -463, 462, -462, 460, -460, 459, -459,
+	458, -458, 457, -457, 455, -455, 454, -454, 453, -453, 452, -452, 450, -450, 449, -449,
+	448, -448, 447, -447, 446, -446, 444, -444, 443, -443, 442, -442, 441, -441, 440, -440,
+	438, -438, 437, -437, 436, -436, 435, -435, 434, -434, 433, -433, 431, -431, 430, -430,
+	429, -429, 428, -428, 427, -427, 426, -426, 424, -424, 423, -423, 422, -422, 421, -421,
+	420, -420, 419, -419, 418, -418, 416, -416, 415, -415, 414, -414, 413, -413, 412, -412,
+	411, -411, 410, -410, 409, -409, 407, -407, 406, -406, 405, -405, 404, -404, 403, -403,
+	402, -402, 401, -401, 400, -400, 399, -399, 398, -398, 397, -397, 396, -396, 394, -394,
+	393, -393, 392, -392, 391, -391, 390, -390, 389, -389, 388, -388, 387, -387, 386, -386,
+	385, -385, 384, -384, 383, -383, 382, -382, 381, -381, 380, -380, 379, -379, 378, -378,
+	377, -377, 376, -376, 375, -375, 374, -374, 373, -373, 372, -372, 371, -371, 370, -370,
+	369, -369, 368, -368, 367, -367, 366, -366, 365, -365, 364, -364, 363, -363, 362, -362,
+	361, -361, 360, -360, 359, -359, 358, -358, 357, -357, 356, -356, 355, -355, 354, -354,
+	353, -353, 352, -352, 351, -351, 350, -350, 349, -349, 348, -348, 347, -347, 346, -346,
+	345, -345, 344, -344, 344, -344, 343, -343, 342, -342, 341, -341, 340, -340, 339, -339,
+	338, -338, 337, -337, 336, -336, 335, -335, 334, -334, 333, -333, 333, -333, 332, -332,
+	331, -331, 330, -330, 329, -329, 328, -328, 327, -327, 326, -326, 325, -325, 325, -325,
+	324, -324, 323, -323, 322, -322, 321, -321, 320, -320, 319, -319, 318, -318, 318, -318,
+	317, -317, 316, -316, 315, -315, 314, -314, 313, -313, 312, -312, 312, -312, 311, -311,
+	310, -310, 309, -309, 308, -308, 307, -307, 307, -307, 306, -306, 305, -305, 304, -304,
+	303, -303, 302, -302, 302, -302, 301, -301, 300, -300, 299, -299, 298, -298, 298, -298,
+	297, -297, 296, -296, 295, -295, 294, -294, 294, -294, 293, -293, 292, -292, 291, -291,
+	290, -290, 290, -290, 289, -289, 288, -288, 287, -287, 286, -286, 286, -286, 285, -285,
+	284, -284, 283, -283, 283, -283, 282, -282, 281, -281, 280, -280, 280, -280, 279, -279,
+	278, -278, 277, -277, 277, -277, 276, -276, 275, -275, 274, -274, 274, -274, 273, -273,
+	272, -272, 271, -271, 271, -271, 270, -270, 269, -269, 268, -268, 268, -268, 267, -267,
+	266, -266, 266, -266, 265, -265, 264, -264, 263, -263, 263, -263, 262, -262, 261, -261,
+	261, -261, 260, -260, 259, -259, 258, -258, 258, -258, 257, -257, 256, -256, 256, -256,
+	255, -255, 254, -254, 253, -253, 253, -253, 252, -252, 251, -251, 251, -251, 250, -250,
+	249, -249, 249, -249, 248, -248, 247, -247, 247, -247, 246, -246, 245, -245, 245, -245,
+	244, -244, 243, -243, 243, -243, 242, -242, 241, -241, 241, -241, 240, -240, 239, -239,
+	239, -239, 238, -238, 238, -238, 237, -237, 236, -236, 236, -236, 235, -235, 234, -234,
+	234, -234, 233, -233, 232, -232, 232, -232, 231, -231, 231, -231, 230, -230, 229, -229,
+	229, -229, 228, -228, 227, -227, 227, -227, 226, -226, 226, -226, 225, -225, 224, -224,
+	224, -224, 223, -223, 223, -223, 222, -222, 221, -221, 221, -221, 220, -220, 220, -220,
+	219, -219, 218, -218, 218, -218, 217, -217, 217, -217, 216, -216, 215, -215, 215, -215,
+	214, -214, 214, -214, 213, -213, 213, -213, 212, -212, 211, -211, 211, -211, 210, -210,
+	210, -210, 209, -209, 209, -209, 208, -208, 207, -207, 207, -207, 206, -206, 206, -206,
+	205, -205, 205, -205, 204, -204, 203, -203, 203, -203, 202, -202, 202, -202, 201, -201,
+	201, -201, 200, -200, 200, -200, 199, -199, 199, -199, 198, -198, 198, -198, 197, -197,
+	196, -196, 196, -196, 195, -195, 195, -195, 194, -194, 194, -194, 193, -193, 193, -193,
+	192, -192, 192, -192, 191, -191, 191, -191, 190, -190, 190, -190, 189, -189, 189, -189,
+	188, -188, 188, -188, 187, -187, 187, -187, 186, -186, 186, -186, 185, -185, 185, -185,
+	184, -184, 184, -184, 183, -183, 183, -183, 182, -182, 182, -182, 181, -181, 181, -181,
+	180, -180, 180, -180, 179, -179, 179, -179, 178, -178, 178, -178, 177, -177, 177, -177,
+	176, -176, 176, -176, 175, -175, 175, -175, 174, -174, 174, -174, 173, -173, 173, -173,
+	172, -172, 172, -172, 172, -172, 171, -171, 171, -171, 170, -170, 170, -170, 169, -169,
+	169, -169, 168, -168, 168, -168, 167, -167, 167, -167, 166, -166, 166, -166, 166, -166,
+	165, -165, 165, -165, 164, -164, 164, -164, 163, -163, 163, -163, 162, -162, 162, -162,
+	162, -162, 161, -161, 161, -161, 160, -160, 160, -160, 159, -159, 159, -159, 159, -159,
+	158, -158, 158, -158, 157, -157, 157, -157, 156, -156, 156, -156, 156, -156, 155, -155,
+	155, -155, 154, -154, 154, -154, 153, -153, 153, -153, 153, -153, 152, -152, 152, -152,
+	151, -151, 151, -151, 151, -151, 150, -150, 150, -150, 149, -149, 149, -149, 149, -149,
+	148, -148, 148, -148, 147, -147, 147, -147, 147, -147, 146, -146, 146, -146, 145, -145,
+	145, -145, 145, -145, 144, -144, 144, -144, 143, -143, 143, -143, 143, -143, 142, -142,
+	142, -142, 141, -141, 141, -141, 141, -141, 140, -140, 140, -140, 140, -140, 139, -139,
+	139, -139, 138, -138, 138, -138, 138, -138, 137, -137, 137, -137, 137, -137, 136, -136,
+	136, -136, 135, -135, 135, -135, 135, -135, 134, -134, 134, -134, 134, -134, 133, -133,
+	133, -133, 133, -133, 132, -132, 132, -132, 131, -131, 131, -131, 131, -131, 130, -130,
+	130, -130, 130, -130, 129, -129, 129, -129, 129, -129, 128, -128, 128, -128, 128, -128,
+	127, -127, 127, -127, 126, -126, 126, -126, 126, -126, 125, -125, 125, -125, 125, -125,
+	124, -124, 124, -124, 124, -124, 123, -123, 123, -123, 123, -123, 122, -122, 122, -122,
+	122, -122, 121, -121, 121, -121, 121, -121, 120, -120, 120, -120, 120, -120, 119, -119,
+	119, -119, 119, -119, 119, -119, 118, -118, 118, -118, 118, -118, 117, -117, 117, -117,
+	117, -117, 116, -116, 116, -116, 116, -116, 115, -115, 115, -115, 115, -115, 114, -114,
+	114, -114, 114, -114, 113, -113, 113, -113, 113, -113, 113, -113, 112, -112, 112, -112,
+	112, -112, 111, -111, 111, -111, 111, -111, 110, -110, 110, -110, 110, -110, 110, -110,
+	109, -109, 109, -109, 109, -109, 108, -108, 108, -108, 108, -108, 107, -107, 107, -107,
+	107, -107, 107, -107, 106, -106, 106, -106, 106, -106, 105, -105, 105, -105, 105, -105,
+	105, -105, 104, -104, 104, -104, 104, -104, 103, -103, 103, -103, 103, -103, 103, -103,
+	102, -102, 102, -102, 102, -102, 101, -101, 101, -101, 101, -101, 101, -101, 100, -100,
+	100, -100, 100, -100, 100, -100, 99, -99, 99, -99, 99, -99, 99, -99, 98, -98,
+	98, -98, 98, -98, 97, -97, 97, -97, 97, -97, 97, -97, 96, -96, 96, -96,
+	96, -96, 96, -96, 95, -95, 95, -95, 95, -95, 95, -95, 94, -94, 94, -94,
+	94, -94, 94, -94, 93, -93, 93, -93, 93, -93, 93, -93, 92, -92, 92, -92,
+	92, -92, 92, -92, 91, -91, 91, -91, 91, -91, 91, -91, 90, -90, 90, -90,
+	90, -90, 90, -90, 89, -89, 89, -89, 89, -89, 89, -89, 88, -88, 88, -88,
+	88, -88, 88, -88, 87, -87, 87, -87, 87, -87, 87, -87, 86, -86, 86, -86,
+	86, -86, 86, -86, 86, -86, 85, -85, 85, -85, 85, -85, 85, -85, 84, -84,
+	84, -84, 84, -84, 84, -84, 83, -83, 83, -83, 83, -83, 83, -83, 83, -83,
+	82, -82, 82, -82, 82, -82, 82, -82, 81, -81, 81, -81, 81, -81, 81, -81,
+	81, -81, 80, -80, 80, -80, 80, -80, 80, -80, 79, -79, 79, -79, 79, -79,
+	79, -79, 79, -79, 78, -78, 78, -78, 78, -78, 78, -78, 78, -78, 77, -77,
+	77, -77, 77, -77, 77, -77, 76, -76, 76, -76, 76, -76, 76, -76, 76, -76,
+	75, -75, 75, -75, 75, -75, 75, -75, 75, -75, 74, -74, 74, -74, 74, -74,
+	74, -74, 74, -74, 73, -73, 73, -73, 73, -73, 73, -73, 73, -73, 72, -72,
+	72, -72, 72, -72, 72, -72, 72, -72, 71, -71, 71, -71, 71, -71, 71, -71,
+	71, -71, 70, -70, 70, -70, 70, -70, 70, -70, 70, -70, 70, -70, 69, -69,
+	69, -69, 69, -69, 69, -69, 69, -69, 68, -68, 68, -68, 68, -68, 68, -68,
+	68, -68, 67, -67, 67, -67, 67, -67, 67, -67, 67, -67, 67, -67, 66, -66,
+	66, -66, 66, -66, 66, -66, 66, -66, 65, -65, 65, -65, 65, -65, 65, -65,
+	65, -65, 65, -65, 64, -64, 64, -64, 64, -64, 64, -64, 64, -64, 64, -64,
+	63, -63, 63, -63, 63, -63, 63, -63, 63, -63, 62, -62, 62, -62, 62, -62,
+	62, -62, 62, -62, 62, -62, 61, -61, 61, -61, 61, -61, 61, -61, 61, -61,
+	61, -61, 60, -60, 60, -60, 60, -60, 60, -60, 60, -60, 60, -60, 59, -59,
+	59, -59, 59, -59, 59, -59, 59, -59, 59, -59, 59, -59, 58, -58, 58, -58,
+	58, -58, 58, -58, 58, -58, 58, -58, 57, -57, 57, -57, 57, -57, 57, -57,
+	57, -57, 57, -57, 56, -56, 56, -56, 56, -56, 56, -56, 56, -56, 56, -56,
+	56, -56, 55, -55, 55, -55, 55, -55, 55, -55, 55, -55, 55, -55, 55, -55,
+	54, -54, 54, -54, 54, -54, 54, -54, 54, -54, 54, -54, 53, -53, 53, -53,
+	53, -53, 53, -53, 53, -53, 53, -53, 53, -53, 52, -52, 52, -52, 52, -52,
+	52, -52, 52, -52, 52, -52, 52, -52, 51, -51, 51, -51, 51, -51, 51, -51,
+	51, -51, 51, -51, 51, -51, 50, -50, 50, -50, 50, -50, 50, -50, 50, -50,
+	50, -50, 50, -50, 50, -50, 49, -49, 49, -49, 49, -49, 49, -49, 49, -49,
+	49, -49, 49, -49, 48, -48, 48, -48, 48, -48, 48, -48, 48, -48, 48, -48,
+	48, -48, 48, -48, 47, -47, 47, -47, 47, -47, 47, -47, 47, -47, 47, -47,
+	47, -47, 47, -47, 46, -46, 46, -46, 46, -46, 46, -46, 46, -46, 46, -46,
+	46, -46, 46, -46, 45, -45, 45, -45, 45, -45, 45, -45, 45, -45, 45, -45,
+	45, -45, 45, -45, 44, -44, 44, -44, 44, -44, 44, -44, 44, -44, 44, -44,
+	44, -44, 44, -44, 43, -43, 43, -43, 43, -43, 43, -43, 43, -43, 43, -43,
+	43, -43, 43, -43, 43, -43, 42, -42, 42, -42, 42, -42, 42, -42, 42, -42,
+	42, -42, 42, -42, 42, -42, 41, -41, 41, -41, 41, -41, 41, -41, 41, -41,
+	41, -41, 41, -41, 41, -41, 41, -41, 40, -40, 40, -40, 40, -40, 40, -40,
+	40, -40, 40, -40, 40, -40, 40, -40, 40, -40, 39, -39, 39, -39, 39, -39,
+	39, -39, 39, -39, 39, -39, 39, -39, 39, -39, 39, -39, 39, -39, 38, -38,
+	38, -38, 38, -38, 38, -38, 38, -38, 38, -38, 38, -38, 38, -38, 38, -38,
+	37, -37, 37, -37, 37, -37, 37, -37, 37, -37, 37, -37, 37, -37, 37, -37,
+	37, -37, 37, -37, 36, -36, 36, -36, 36, -36, 36, -36, 36, -36, 36, -36,
+	36, -36, 36, -36, 36, -36, 36, -36, 35, -35, 35, -35, 35, -35, 35, -35,
+	35, -35, 35, -35, 35, -35, 35, -35, 35, -35, 35, -35, 35, -35, 34, -34,
+	34, -34, 34, -34, 34, -34, 34, -34, 34, -34, 34, -34, 34, -34, 34, -34,
+	34, -34, 33, -33, 33, -33, 33, -33, 33, -33, 33, -33, 33, -33, 33, -33,
+	33, -33, 33, -33, 33, -33, 33, -33, 32, -32, 32, -32, 32, -32, 32, -32,
+	32, -32, 32, -32, 32, -32, 32, -32, 32, -32, 32, -32, 32, -32, 32, -32,
+	31, -31, 31, -31, 31, -31, 31, -31, 31, -31, 31, -31, 31, -31, 31, -31,
+	31, -31, 31, -31, 31, -31, 30, -30, 30, -30, 30, -30, 30, -30, 30, -30,
+	30, -30, 30, -30, 30, -30, 30, -30, 30, -30, 30, -30, 30, -30, 29, -29,
+	29, -29, 29, -29, 29, -29, 29, -29, 29, -29, 29, -29, 29, -29, 29, -29,
+	29, -29, 29, -29, 29, -29, 29, -29, 28, -28, 28, -28, 28, -28, 28, -28,
+	28, -28, 28, -28, 28, -28, 28, -28, 28, -28, 28, -28, 28, -28, 28, -28,
+	28, -28, 27, -27, 27, -27, 27, -27, 27, -27, 27, -27, 27, -27, 27, -27,
+	27, -27, 27, -27, 27, -27, 27, -27, 27, -27, 27, -27, 26, -26, 26, -26,
+	26, -26, 26, -26, 26, -26, 26, -26, 26, -26, 26, -26, 26, -26, 26, -26,
+	26, -26, 26, -26, 26, -26, 26, -26, 25, -25, 25, -25, 25, -25, 25, -25,
+	25, -25, 25, -25, 25, -25, 25, -25, 25, -25, 25, -25, 25, -25, 25, -25,
+	25, -25, 25, -25, 25, -25, 24, -24, 24, -24, 24, -24, 24, -24, 24, -24,
+	24, -24, 24, -24, 24, -24, 24, -24, 24, -24, 24, -24, 24, -24, 24, -24,
+	24, -24, 24, -24, 23, -23, 23, -23, 23, -23, 23, -23, 23, -23, 23, -23,
+	23, -23, 23, -23, 23, -23, 23, -23, 23, -23, 23, -23, 23, -23, 23, -23,
+	23, -23, 23, -23, 22, -22, 22, -22, 22, -22, 22, -22, 22, -22, 22, -22,
+	22, -22, 22, -22, 22, -22, 22, -22, 22, -22, 22, -22, 22, -22, 22, -22,
+	22, -22, 22, -22, 21, -21, 21, -21, 21, -21, 21, -21, 21, -21, 21, -21,
+	21, -21, 21, -21, 21, -21, 21, -21, 21, -21, 21, -21, 21, -21, 21, -21,
+	21, -21, 21, -21, 21, -21, 20, -20, 20, -20, 20, -20, 20, -20, 20, -20,
+	20, -20, 20, -20, 20, -20, 20, -20, 20, -20, 20, -20, 20, -20, 20, -20,
+	20, -20, 20, -20, 20, -20, 20, -20, 20, -20, 19, -19, 19, -19, 19, -19,
+	19, -19, 19, -19, 19, -19, 19, -19, 19, -19, 19, -19, 19, -19, 19, -19,
+	19, -19, 19, -19, 19, -19, 19, -19, 19, -19, 19, -19, 19, -19, 19, -19,
+	18, -18, 18, -18, 18, -18, 18, -18, 18, -18, 18, -18, 18, -18, 18, -18,
+	18, -18, 18, -18, 18, -18, 18, -18, 18, -18, 18, -18, 18, -18, 18, -18,
+	18, -18, 18, -18, 18, -18, 18, -18, 17, -17, 17, -17, 17, -17, 17, -17,
+	17, -17, 17, -17, 17, -17, 17, -17, 17, -17, 17, -17, 17, -17, 17, -17,
+	17, -17, 17, -17, 17, -17, 17, -17, 17, -17, 17, -17, 17, -17, 17, -17,
+	17, -17, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16,
+	16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16,
+	16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16, 16, -16,
+	15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15,
+	15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15,
+	15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 15, -15, 14, -14,
+	14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14,
+	14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14,
+	14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14, 14, -14,
+	14, -14, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13,
+	13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13,
+	13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13, 13, -13,
+	13, -13, 13, -13, 13, -13, 13, -13, 12, -12, 12, -12, 12, -12, 12, -12,
+	12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12,
+	12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12,
+	12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12, 12, -12,
+	12, -12, 12, -12, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11,
+	11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11,
+	11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11,
+	11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11, 11, -11,
+	11, -11, 11, -11, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10,
+	10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10,
+	10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10,
+	10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 10, -10,
+	10, -10, 10, -10, 10, -10, 10, -10, 10, -10, 9, -9, 9, -9, 9, -9,
+	9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9,
+	9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9,
+	9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9,
+	9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9, 9, -9,
+	9, -9, 9, -9, 9, -9, 9, -9, 8, -8, 8, -8, 8, -8, 8, -8,
+	8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8,
+	8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8,
+	8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8,
+	8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8,
+	8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8, 8, -8,
+	7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7,
+	7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7,
+	7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7,
+	7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7,
+	7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7,
+	7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7, 7, -7,
+	7, -7, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6,
+	6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6,
+	6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6,
+	6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6,
+	6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6,
+	6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6,
+	6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6, 6, -6,
+	6, -6, 6, -6, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+	5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+	5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+	5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+	5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+	5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+	5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+	5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 5, -5,
+	5, -5, 5, -5, 5, -5, 5, -5, 5, -5, 4, -4, 4, -4, 4, -4,
+	4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+	4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+	4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+	4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+	4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+	4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+	4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+	4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+	4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+	4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4, 4, -4,
+	3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+	3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+	3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+	3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+	3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+	3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+	3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+	3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+	3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+	3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+	3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+	3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+	3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3, 3, -3,
+	3, -3, 3, -3, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2, 2, -2,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+	1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+};
+
+static const unsigned int sin_tab[YM2151_SIN_LEN] = {
+	4274, 3462, 3086, 2838, 2652, 2504, 2380, 2274, 2182, 2100, 2026, 1958, 1898, 1840, 1788, 1738,
+	1692, 1650, 1608, 1570, 1534, 1498, 1464, 1434, 1402, 1374, 1344, 1318, 1292, 1266, 1242, 1218,
+	1196, 1174, 1152, 1132, 1112, 1092, 1072, 1054, 1036, 1018, 1002, 984, 968, 952, 936, 922,
+	906, 892, 878, 864, 850, 836, 822, 810, 798, 784, 772, 760, 750, 738, 726, 716,
+	704, 694, 682, 672, 662, 652, 642, 632, 622, 614, 604, 594, 586, 578, 568, 560,
+	552, 542, 534, 526, 518, 510, 502, 496, 488, 480, 472, 466, 458, 452, 444, 438,
+	430, 424, 418, 410, 404, 398, 392, 386, 380, 374, 368, 362, 356, 350, 344, 338,
+	334, 328, 322, 318, 312, 306, 302, 296, 292, 286, 282, 276, 272, 268, 262, 258,
+	254, 250, 244, 240, 236, 232, 228, 224, 220, 216, 212, 208, 204, 200, 196, 192,
+	188, 184, 182, 178, 174, 170, 166, 164, 160, 156, 154, 150, 148, 144, 140, 138,
+	134, 132, 128, 126, 124, 120, 118, 114, 112, 110, 106, 104, 102, 98, 96, 94,
+	92, 90, 86, 84, 82, 80, 78, 76, 74, 72, 70, 68, 66, 64, 62, 60,
+	58, 56, 54, 52, 50, 48, 46, 46, 44, 42, 40, 40, 38, 36, 34, 34,
+	32, 30, 30, 28, 26, 26, 24, 24, 22, 20, 20, 18, 18, 16, 16, 14,
+	14, 14, 12, 12, 10, 10, 10, 8, 8, 8, 6, 6, 6, 4, 4, 4,
+	4, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 4,
+	4, 4, 4, 6, 6, 6, 8, 8, 8, 10, 10, 10, 12, 12, 14, 14,
+	14, 16, 16, 18, 18, 20, 20, 22, 24, 24, 26, 26, 28, 30, 30, 32,
+	34, 34, 36, 38, 40, 40, 42, 44, 46, 46, 48, 50, 52, 54, 56, 58,
+	60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 90, 92,
+	94, 96, 98, 102, 104, 106, 110, 112, 114, 118, 120, 124, 126, 128, 132, 134,
+	138, 140, 144, 148, 150, 154, 156, 160, 164, 166, 170, 174, 178, 182, 184, 188,
+	192, 196, 200, 204, 208, 212, 216, 220, 224, 228, 232, 236, 240, 244, 250, 254,
+	258, 262, 268, 272, 276, 282, 286, 292, 296, 302, 306, 312, 318, 322, 328, 334,
+	338, 344, 350, 356, 362, 368, 374, 380, 386, 392, 398, 404, 410, 418, 424, 430,
+	438, 444, 452, 458, 466, 472, 480, 488, 496, 502, 510, 518, 526, 534, 542, 552,
+	560, 568, 578, 586, 594, 604, 614, 622, 632, 642, 652, 662, 672, 682, 694, 704,
+	716, 726, 738, 750, 760, 772, 784, 798, 810, 822, 836, 850, 864, 878, 892, 906,
+	922, 936, 952, 968, 984, 1002, 1018, 1036, 1054, 1072, 1092, 1112, 1132, 1152, 1174, 1196,
+	1218, 1242, 1266, 1292, 1318, 1344, 1374, 1402, 1434, 1464, 1498, 1534, 1570, 1608, 1650, 1692,
+	1738, 1788, 1840, 1898, 1958, 2026, 2100, 2182, 2274, 2380, 2504, 2652, 2838, 3086, 3462, 4274,
+	4275, 3463, 3087, 2839, 2653, 2505, 2381, 2275, 2183, 2101, 2027, 1959, 1899, 1841, 1789, 1739,
+	1693, 1651, 1609, 1571, 1535, 1499, 1465, 1435, 1403, 1375, 1345, 1319, 1293, 1267, 1243, 1219,
+	1197, 1175, 1153, 1133, 1113, 1093, 1073, 1055, 1037, 1019, 1003, 985, 969, 953, 937, 923,
+	907, 893, 879, 865, 851, 837, 823, 811, 799, 785, 773, 761, 751, 739, 727, 717,
+	705, 695, 683, 673, 663, 653, 643, 633, 623, 615, 605, 595, 587, 579, 569, 561,
+	553, 543, 535, 527, 519, 511, 503, 497, 489, 481, 473, 467, 459, 453, 445, 439,
+	431, 425, 419, 411, 405, 399, 393, 387, 381, 375, 369, 363, 357, 351, 345, 339,
+	335, 329, 323, 319, 313, 307, 303, 297, 293, 287, 283, 277, 273, 269, 263, 259,
+	255, 251, 245, 241, 237, 233, 229, 225, 221, 217, 213, 209, 205, 201, 197, 193,
+	189, 185, 183, 179, 175, 171, 167, 165, 161, 157, 155, 151, 149, 145, 141, 139,
+	135, 133, 129, 127, 125, 121, 119, 115, 113, 111, 107, 105, 103, 99, 97, 95,
+	93, 91, 87, 85, 83, 81, 79, 77, 75, 73, 71, 69, 67, 65, 63, 61,
+	59, 57, 55, 53, 51, 49, 47, 47, 45, 43, 41, 41, 39, 37, 35, 35,
+	33, 31, 31, 29, 27, 27, 25, 25, 23, 21, 21, 19, 19, 17, 17, 15,
+	15, 15, 13, 13, 11, 11, 11, 9, 9, 9, 7, 7, 7, 5, 5, 5,
+	5, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3, 3, 3, 3, 5,
+	5, 5, 5, 7, 7, 7, 9, 9, 9, 11, 11, 11, 13, 13, 15, 15,
+	15, 17, 17, 19, 19, 21, 21, 23, 25, 25, 27, 27, 29, 31, 31, 33,
+	35, 35, 37, 39, 41, 41, 43, 45, 47, 47, 49, 51, 53, 55, 57, 59,
+	61, 63, 65, 67, 69, 71, 73, 75, 77, 79, 81, 83, 85, 87, 91, 93,
+	95, 97, 99, 103, 105, 107, 111, 113, 115, 119, 121, 125, 127, 129, 133, 135,
+	139, 141, 145, 149, 151, 155, 157, 161, 165, 167, 171, 175, 179, 183, 185, 189,
+	193, 197, 201, 205, 209, 213, 217, 221, 225, 229, 233, 237, 241, 245, 251, 255,
+	259, 263, 269, 273, 277, 283, 287, 293, 297, 303, 307, 313, 319, 323, 329, 335,
+	339, 345, 351, 357, 363, 369, 375, 381, 387, 393, 399, 405, 411, 419, 425, 431,
+	439, 445, 453, 459, 467, 473, 481, 489, 497, 503, 511, 519, 527, 535, 543, 553,
+	561, 569, 579, 587, 595, 605, 615, 623, 633, 643, 653, 663, 673, 683, 695, 705,
+	717, 727, 739, 751, 761, 773, 785, 799, 811, 823, 837, 851, 865, 879, 893, 907,
+	923, 937, 953, 969, 985, 1003, 1019, 1037, 1055, 1073, 1093, 1113, 1133, 1153, 1175, 1197,
+	1219, 1243, 1267, 1293, 1319, 1345, 1375, 1403, 1435, 1465, 1499, 1535, 1571, 1609, 1651, 1693,
+	1739, 1789, 1841, 1899, 1959, 2027, 2101, 2183, 2275, 2381, 2505, 2653, 2839, 3087, 3463, 4275,
+};
+
+static const uint32_t d1l_tab[16] = {
+	0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448, 992,
+};
+
+#endif // YM2151_TABLES_H_INCLUDED
@@ -4,9 +4,11 @@
 #ifndef LEGACY_H_INCLUDED
 #define LEGACY_H_INCLUDED
 
+#include "context.h"
 #include "drv/quattro.h"
 
-// use DriverInterface instead. will be removed once DriverGetStatus or something like that gets implemented...
-    Q_State *QDrv;
+// use Context->DriverInterface instead. will be removed once DriverGetStatus or something like that gets implemented...
+extern QP_Context *Context;
+#define QDrv ((Q_State*)Context->DriverInterface->Driver)
 
 #endif // LEGACY_H_INCLUDED
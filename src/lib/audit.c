@@ -13,6 +13,8 @@
 #include "ini.h"
 #include "audit.h"
 
+QP_Audit *Audit;
+
 int AuditRoms(void* data)
 {
     QP_Audit* audit = data;
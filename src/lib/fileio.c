@@ -6,19 +6,29 @@
 #include <stdint.h>
 #include <string.h>
 #include <errno.h>
+#include <stdarg.h>
 
 #include "fileio.h"
 
-    char fileio_error[100];
+// set the error message, if requested
+static void fileio_seterror(char* error, const char* fmt, ...)
+{
+    va_list args;
+    if(!error)
+        return;
+    va_start(args,fmt);
+    vsnprintf(error,FILEIO_ERROR_SIZE,fmt,args);
+    va_end(args);
+}
 
-int load_file(char* filename, uint8_t** dataptr, uint32_t* filesize)
+int load_file(char* filename, uint8_t** dataptr, uint32_t* filesize, char* error)
 {
     FILE* sourcefile;
     sourcefile = fopen(filename,"rb");
 
     if(!sourcefile)
     {
-        strcpy(fileio_error,strerror(errno));
+        fileio_seterror(error,"%s",strerror(errno));
         fprintf(stderr,"Could not open %s\n",filename);
         perror("Error");
         return -1;
@@ -31,8 +41,8 @@ int load_file(char* filename, uint8_t** dataptr, uint32_t* filesize)
     int32_t res = fread(*dataptr,1,*filesize,sourcefile);
     if(res != *filesize)
     {
-        strcpy(fileio_error,"Read error");
-        fputs(fileio_error,stderr);
+        fileio_seterror(error,"Read error");
+        fputs("Read error\n",stderr);
         fclose(sourcefile);
         return -1;
     }
@@ -42,7 +52,7 @@ int load_file(char* filename, uint8_t** dataptr, uint32_t* filesize)
 }
 
 // This does not allocate new resources
-int read_file(char* filename, uint8_t* dataptr, uint32_t load_size, uint32_t load_offset, int byteswap, uint32_t* fsize)
+int read_file(char* filename, uint8_t* dataptr, uint32_t load_size, uint32_t load_offset, int byteswap, uint32_t* fsize, char* error)
 {
     uint32_t cnt;
     uint32_t filesize;
@@ -53,7 +63,7 @@ int read_file(char* filename, uint8_t* dataptr, uint32_t load_size, uint32_t loa
 
     if(!sourcefile)
     {
-        strcpy(fileio_error,strerror(errno));
+        fileio_seterror(error,"%s",strerror(errno));
         fprintf(stderr,"Could not open %s\n",filename);
         perror("Error");
         return -1;
@@ -67,9 +77,8 @@ int read_file(char* filename, uint8_t* dataptr, uint32_t load_size, uint32_t loa
 
     if(load_offset >= filesize)
     {
-        //strcpy(fileio_error,"Read offset exceeds file size  );
-        sprintf(fileio_error,"Read offset (%d) exceeds file size (%d)\n",load_offset,filesize);
-        fputs(fileio_error,stderr);
+        fileio_seterror(error,"Read offset (%d) exceeds file size (%d)",load_offset,filesize);
+        fprintf(stderr,"Read offset (%d) exceeds file size (%d)\n",load_offset,filesize);
         fclose(sourcefile);
         return -1;
     }
@@ -79,8 +88,7 @@ int read_file(char* filename, uint8_t* dataptr, uint32_t load_size, uint32_t loa
 
     if(load_size+load_offset > filesize)
     {
-        sprintf(fileio_error,"Warning: Read length (%d) exceeds file size (%d)\n",load_size+load_offset,filesize);
-        fputs(fileio_error,stderr);
+        fprintf(stderr,"Warning: Read length (%d) exceeds file size (%d)\n",load_size+load_offset,filesize);
         load_size = filesize - load_offset;
     }
 
@@ -92,8 +100,8 @@ int read_file(char* filename, uint8_t* dataptr, uint32_t load_size, uint32_t loa
     int32_t res = fread(dataptr,1,load_size,sourcefile);
     if(res != load_size)
     {
-        strcpy(fileio_error,"Read error");
-        fputs(fileio_error,stderr);
+        fileio_seterror(error,"Read error");
+        fputs("Read error\n",stderr);
         fclose(sourcefile);
         return -1;
     }
@@ -117,7 +125,7 @@ int read_file(char* filename, uint8_t* dataptr, uint32_t load_size, uint32_t loa
 }
 
 
-int write_file(char* filename, uint8_t* dataptr, uint32_t datasize)
+int write_file(char* filename, uint8_t* dataptr, uint32_t datasize, char* error)
 {
     FILE *destfile;
 
@@ -130,8 +138,7 @@ int write_file(char* filename, uint8_t* dataptr, uint32_t datasize)
     int32_t res = fwrite(dataptr, 1, datasize, destfile);
     if(res != datasize)
     {
-        strcpy(fileio_error,"Read error");
-        fputs(fileio_error,stderr);
+        fileio_seterror(error,"Write error");
         fprintf(stderr,"Writing error\n");
         fclose(destfile);
         return -1;
@@ -141,9 +148,10 @@ int write_file(char* filename, uint8_t* dataptr, uint32_t datasize)
     return 0;
 }
 
-char* my_strerror(char* filename)
+// Append a file error to msg (msgsize bytes including what is already there).
+void my_strerror(char* msg, int msgsize, char* filename, char* error)
 {
-    static char msg[100];
-    snprintf(msg,100,"\n'%s': %s",filename,fileio_error);
-    return msg;
+    int len = strlen(msg);
+    if(len < msgsize)
+        snprintf(msg+len,msgsize-len,"\n'%s': %s",filename,error);
 }
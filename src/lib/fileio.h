@@ -4,12 +4,13 @@
 #ifndef FILEIO_H_INCLUDED
 #define FILEIO_H_INCLUDED
 
-    char fileio_error[100];
+// size of the error buffers, error may be NULL if the message is not needed.
+#define FILEIO_ERROR_SIZE 100
 
-int load_file(char* filename, uint8_t** dataptr, uint32_t* filesize);
-int read_file(char* filename, uint8_t* dataptr, uint32_t load_size, uint32_t load_offset, int byteswap, uint32_t* fsize);
-int write_file(char* filename, uint8_t* dataptr, uint32_t datasize);
+int load_file(char* filename, uint8_t** dataptr, uint32_t* filesize, char* error);
+int read_file(char* filename, uint8_t* dataptr, uint32_t load_size, uint32_t load_offset, int byteswap, uint32_t* fsize, char* error);
+int write_file(char* filename, uint8_t* dataptr, uint32_t datasize, char* error);
 
-char* my_strerror(char* filename);
+void my_strerror(char* msg, int msgsize, char* filename, char* error);
 
 #endif // FILEIO_H_INCLUDED
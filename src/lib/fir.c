@@ -0,0 +1,194 @@
+/*
+    Polyphase FIR interpolation filter
+
+    The coefficient table holds the filter at Phases+1 evenly spaced
+    fractional positions, positions in between are handled by blending
+    the two nearest rows. The dot products are done by a kernel selected
+    at runtime.
+*/
+#include <stdlib.h>
+#include <math.h>
+
+#include "fir.h"
+
+#if defined(FIR_X86)
+#include <immintrin.h>
+#elif defined(FIR_NEON)
+#include <arm_neon.h>
+#endif
+
+// zeroth order modified Bessel function, for the Kaiser window
+static double fir_bessel_i0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    int k;
+    for(k=1;k<50;k++)
+    {
+        term *= (x/(2*k))*(x/(2*k));
+        sum += term;
+        if(term < sum*1e-12)
+            break;
+    }
+    return sum;
+}
+
+// Create a filter. cutoff is relative to the input rate (0.5 = Nyquist),
+// beta is the Kaiser window parameter. Returns -1 on failure.
+int fir_init(fir_t* f, int taps, int phases, int channels, double cutoff, double beta)
+{
+    int p, k, ch, n;
+    double t, w, h[FIR_MAX_TAPS], sum;
+
+    f->Coef = NULL;
+    if(taps < 8 || taps > FIR_MAX_TAPS || taps%8 || phases < 1 || (channels != 1 && channels != 2 && channels != 4))
+        return -1;
+
+    f->Taps = taps;
+    f->Phases = phases;
+    f->Channels = channels;
+    f->Kernel = fir_kernel_select();
+    n = taps*channels;
+    f->Coef = (float*)malloc((phases+1)*n*sizeof(float));
+    if(!f->Coef)
+        return -1;
+
+    for(p=0;p<=phases;p++)
+    {
+        sum = 0;
+        for(k=0;k<taps;k++)
+        {
+            // distance from the output position
+            t = k-(taps/2-1)-(double)p/phases;
+            w = 1.0-(t*t)/((taps/2)*(taps/2));
+            w = w > 0 ? fir_bessel_i0(beta*sqrt(w))/fir_bessel_i0(beta) : 0;
+            h[k] = w * (t == 0 ? 2*cutoff : sin(2*M_PI*cutoff*t)/(M_PI*t));
+            sum += h[k];
+        }
+        // unity gain at DC
+        for(k=0;k<taps;k++)
+            for(ch=0;ch<channels;ch++)
+                f->Coef[p*n+k*channels+ch] = h[k]/sum;
+    }
+    return 0;
+}
+
+void fir_destroy(fir_t* f)
+{
+    free(f->Coef);
+    f->Coef = NULL;
+}
+
+// Filter one output frame. x points to Taps frames, frac is the position
+// between frames Taps/2-1 and Taps/2 (0-1).
+void fir_filter(fir_t* f, const float* x, double frac, float* out)
+{
+    int n = f->Taps*f->Channels, p, ch, k;
+    double pos = frac*f->Phases;
+    float acc[8] = {0};
+
+    p = (int)pos;
+    if(p >= f->Phases)
+        p = f->Phases-1;
+    else if(p < 0)
+        p = 0;
+
+    f->Kernel(f->Coef+p*n,f->Coef+(p+1)*n,pos-p,x,n,acc);
+
+    for(ch=0;ch<f->Channels;ch++)
+    {
+        out[ch] = 0;
+        for(k=ch;k<8;k+=f->Channels)
+            out[ch] += acc[k];
+    }
+}
+
+void fir_kernel_c(const float* c0, const float* c1, float a, const float* x, int n, float* acc)
+{
+    int i, k;
+    for(i=0;i<n;i+=8)
+    {
+        for(k=0;k<8;k++)
+            acc[k] += (c0[i+k] + a*(c1[i+k]-c0[i+k])) * x[i+k];
+    }
+}
+
+#if defined(FIR_X86)
+
+__attribute__((target("sse2")))
+void fir_kernel_sse2(const float* c0, const float* c1, float a, const float* x, int n, float* acc)
+{
+    const __m128 va = _mm_set1_ps(a);
+    __m128 lo = _mm_loadu_ps(acc), hi = _mm_loadu_ps(acc+4), c, d;
+    int i;
+
+    for(i=0;i<n;i+=8)
+    {
+        c = _mm_loadu_ps(c0+i);
+        d = _mm_loadu_ps(c1+i);
+        c = _mm_add_ps(c,_mm_mul_ps(va,_mm_sub_ps(d,c)));
+        lo = _mm_add_ps(lo,_mm_mul_ps(c,_mm_loadu_ps(x+i)));
+
+        c = _mm_loadu_ps(c0+i+4);
+        d = _mm_loadu_ps(c1+i+4);
+        c = _mm_add_ps(c,_mm_mul_ps(va,_mm_sub_ps(d,c)));
+        hi = _mm_add_ps(hi,_mm_mul_ps(c,_mm_loadu_ps(x+i+4)));
+    }
+    _mm_storeu_ps(acc,lo);
+    _mm_storeu_ps(acc+4,hi);
+}
+
+__attribute__((target("avx")))
+void fir_kernel_avx(const float* c0, const float* c1, float a, const float* x, int n, float* acc)
+{
+    const __m256 va = _mm256_set1_ps(a);
+    __m256 s = _mm256_loadu_ps(acc), c, d;
+    int i;
+
+    for(i=0;i<n;i+=8)
+    {
+        c = _mm256_loadu_ps(c0+i);
+        d = _mm256_loadu_ps(c1+i);
+        c = _mm256_add_ps(c,_mm256_mul_ps(va,_mm256_sub_ps(d,c)));
+        s = _mm256_add_ps(s,_mm256_mul_ps(c,_mm256_loadu_ps(x+i)));
+    }
+    _mm256_storeu_ps(acc,s);
+}
+
+#elif defined(FIR_NEON)
+
+void fir_kernel_neon(const float* c0, const float* c1, float a, const float* x, int n, float* acc)
+{
+    float32x4_t lo = vld1q_f32(acc), hi = vld1q_f32(acc+4), c, d;
+    int i;
+
+    for(i=0;i<n;i+=8)
+    {
+        c = vld1q_f32(c0+i);
+        d = vld1q_f32(c1+i);
+        c = vaddq_f32(c,vmulq_n_f32(vsubq_f32(d,c),a));
+        lo = vaddq_f32(lo,vmulq_f32(c,vld1q_f32(x+i)));
+
+        c = vld1q_f32(c0+i+4);
+        d = vld1q_f32(c1+i+4);
+        c = vaddq_f32(c,vmulq_n_f32(vsubq_f32(d,c),a));
+        hi = vaddq_f32(hi,vmulq_f32(c,vld1q_f32(x+i+4)));
+    }
+    vst1q_f32(acc,lo);
+    vst1q_f32(acc+4,hi);
+}
+
+#endif
+
+fir_kernel_t fir_kernel_select()
+{
+#if defined(FIR_X86)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx"))
+        return fir_kernel_avx;
+    if(__builtin_cpu_supports("sse2"))
+        return fir_kernel_sse2;
+#elif defined(FIR_NEON)
+    return fir_kernel_neon;
+#endif
+    return fir_kernel_c;
+}
@@ -0,0 +1,53 @@
+#ifndef FIR_H_INCLUDED
+#define FIR_H_INCLUDED
+
+#include <stdint.h>
+
+// Dot products of two coefficient rows with the input, blended by a:
+//      acc[k%8] += (c0[k] + a*(c1[k]-c0[k])) * x[k]
+// computed as 8 partial sums in the same order by all versions, so the
+// results are identical.
+typedef void (*fir_kernel_t)(const float* c0, const float* c1, float a, const float* x, int n, float* acc);
+
+// Polyphase FIR interpolation filter (Kaiser windowed sinc).
+//
+// The input is a window of Taps frames of interleaved samples. The filter
+// returns the value at a fractional position between frames Taps/2-1 and
+// Taps/2, so the output is delayed by Taps/2-1 input frames compared to
+// linear interpolation between the last two frames.
+typedef struct {
+
+    int Taps;       // filter length, multiple of 8
+    int Phases;     // coefficient rows per input frame
+    int Channels;   // 1, 2 or 4
+
+    // Phases+1 rows of Taps*Channels coefficients, each coefficient is
+    // repeated for every channel so rows line up with the input.
+    float* Coef;
+
+    fir_kernel_t Kernel; // selected by fir_init
+
+} fir_t;
+
+#define FIR_MAX_TAPS 64
+
+int  fir_init(fir_t* f, int taps, int phases, int channels, double cutoff, double beta);
+void fir_destroy(fir_t* f);
+
+void fir_filter(fir_t* f, const float* x, double frac, float* out);
+
+void fir_kernel_c(const float* c0, const float* c1, float a, const float* x, int n, float* acc);
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FIR_X86
+void fir_kernel_sse2(const float* c0, const float* c1, float a, const float* x, int n, float* acc);
+void fir_kernel_avx(const float* c0, const float* c1, float a, const float* x, int n, float* acc);
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define FIR_NEON
+void fir_kernel_neon(const float* c0, const float* c1, float a, const float* x, int n, float* acc);
+#endif
+
+// Pick the fastest kernel supported by the CPU.
+fir_kernel_t fir_kernel_select();
+
+#endif // FIR_H_INCLUDED
@@ -0,0 +1,16 @@
+/*
+    Data hashing (FNV-1a)
+*/
+#include <stdint.h>
+
+#include "hash.h"
+
+uint64_t hash_data(uint64_t hash, const uint8_t* data, uint32_t size)
+{
+    while(size--)
+    {
+        hash ^= *data++;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
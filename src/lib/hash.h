@@ -0,0 +1,11 @@
+#ifndef HASH_H_INCLUDED
+#define HASH_H_INCLUDED
+
+#include <stdint.h>
+
+#define HASH_INIT 0xcbf29ce484222325ULL
+
+// 64-bit FNV-1a. Start with HASH_INIT, feed the previous result to continue.
+uint64_t hash_data(uint64_t hash, const uint8_t* data, uint32_t size);
+
+#endif // HASH_H_INCLUDED
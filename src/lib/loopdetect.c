@@ -162,3 +162,25 @@ int  QP_LoopDetectGetCount(QP_LoopDetect *ld,int trackid)
     }
     return lowest;
 }
+// Save the loop detection state to a state blob.
+void QP_LoopDetectStateSave(QP_LoopDetect *ld,state_t *s)
+{
+    state_write(s,&ld->NextLoopId,sizeof(ld->NextLoopId));
+    if(!ld->Data)
+        return;
+    state_write(s,ld->Song,ld->SongCnt*sizeof(*ld->Song));
+    state_write(s,ld->Track,ld->TrackCnt*sizeof(*ld->Track));
+    state_write_sparse(s,(uint32_t*)ld->Data,ld->DataSize);
+}
+// Load the loop detection state. The loop detection must have been
+// initialized with the same sizes as when saving.
+int QP_LoopDetectStateLoad(QP_LoopDetect *ld,state_t *s)
+{
+    state_read(s,&ld->NextLoopId,sizeof(ld->NextLoopId));
+    if(!ld->Data)
+        return s->error ? -1 : 0;
+    state_read(s,ld->Song,ld->SongCnt*sizeof(*ld->Song));
+    state_read(s,ld->Track,ld->TrackCnt*sizeof(*ld->Track));
+    state_read_sparse(s,(uint32_t*)ld->Data,ld->DataSize);
+    return s->error ? -1 : 0;
+}
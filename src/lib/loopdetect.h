@@ -1,6 +1,8 @@
 #ifndef LOOPDETECT_H_INCLUDED
 #define LOOPDETECT_H_INCLUDED
 
+#include "state.h"
+
 #define LOOPDETECT_MAX_STACK 8
 
 typedef struct QP_LoopDetect QP_LoopDetect;
@@ -45,4 +47,7 @@ void QP_LoopDetectPop(QP_LoopDetect *ld,int trackid); // pop loopid
 
 int  QP_LoopDetectGetCount(QP_LoopDetect *ld,int trackid);
 
+void QP_LoopDetectStateSave(QP_LoopDetect *ld,state_t *s);
+int  QP_LoopDetectStateLoad(QP_LoopDetect *ld,state_t *s);
+
 #endif // LOOPDETECT_H_INCLUDED
@@ -0,0 +1,127 @@
+/*
+    Streaming sample rate converter
+
+    Input frames are kept in a buffer with Taps/2-1 frames of silence in
+    front, so the filter window for input position 0 starts at the
+    beginning of the buffer. Frames before the window of the next output
+    frame are discarded after each read.
+*/
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "resampler.h"
+
+#define RESAMPLER_PHASES 256
+#define RESAMPLER_BLOCK 1024 // input frames buffered in addition to the filter
+
+// Cutoff is relative to the lower of the two rates (0.5 = Nyquist).
+static const struct {
+    int Taps;
+    double Cutoff;
+    double Beta;
+} resampler_presets[RESAMPLER_QUALITY_COUNT-1] = {
+    {16, 0.40, 6.0},
+    {32, 0.45, 8.0},
+    {64, 0.47, 10.0},
+};
+
+// Returns -1 on failure.
+int resampler_init(resampler_t* r, double inrate, double outrate, int channels, int quality)
+{
+    double lower = inrate < outrate ? inrate : outrate;
+    int taps;
+
+    memset(r,0,sizeof(*r));
+    if(inrate <= 0 || outrate <= 0)
+        return -1;
+    if(quality < RESAMPLER_LOW)
+        quality = RESAMPLER_LOW;
+    if(quality > RESAMPLER_HIGH)
+        quality = RESAMPLER_HIGH;
+
+    taps = resampler_presets[quality-1].Taps;
+    if(fir_init(&r->Filter,taps,RESAMPLER_PHASES,channels,
+                resampler_presets[quality-1].Cutoff*lower/inrate,resampler_presets[quality-1].Beta))
+        return -1;
+
+    r->Channels = channels;
+    r->Step = inrate/outrate;
+    r->Limit = UINT64_MAX;
+    r->Size = taps*2+RESAMPLER_BLOCK;
+    r->Length = taps/2-1;
+    r->Buffer = (float*)calloc(r->Size*channels,sizeof(float));
+    if(!r->Buffer)
+    {
+        fir_destroy(&r->Filter);
+        return -1;
+    }
+    return 0;
+}
+
+void resampler_destroy(resampler_t* r)
+{
+    fir_destroy(&r->Filter);
+    free(r->Buffer);
+    r->Buffer = NULL;
+}
+
+// Add input frames. Returns the number of frames taken, which is less
+// than requested when the buffer is full (read some output first).
+int resampler_write(resampler_t* r, const float* in, int frames)
+{
+    // room is kept for the padding added by resampler_drain
+    int space = r->Size - r->Filter.Taps/2 - r->Length;
+    if(frames > space)
+        frames = space;
+    if(frames <= 0)
+        return 0;
+
+    memcpy(r->Buffer+r->Length*r->Channels,in,frames*r->Channels*sizeof(float));
+    r->Length += frames;
+    r->Input += frames;
+    return frames;
+}
+
+// Get output frames. Returns the number of frames written, which is less
+// than requested when more input is needed.
+int resampler_read(resampler_t* r, float* out, int frames)
+{
+    int n = 0, i, taps = r->Filter.Taps;
+
+    while(n < frames && r->Output < r->Limit)
+    {
+        i = (int)r->Pos;
+        if(i + taps > r->Length)
+            break;
+        fir_filter(&r->Filter,r->Buffer+i*r->Channels,r->Pos-i,out+n*r->Channels);
+        r->Pos += r->Step;
+        r->Output++;
+        n++;
+    }
+
+    // discard input before the next window
+    i = (int)r->Pos;
+    if(i > r->Length)
+        i = r->Length;
+    if(i > 0)
+    {
+        memmove(r->Buffer,r->Buffer+i*r->Channels,(r->Length-i)*r->Channels*sizeof(float));
+        r->Length -= i;
+        r->Pos -= i;
+    }
+    return n;
+}
+
+// End of input. The remaining output (up to the position of the last
+// input frame) can then be read.
+void resampler_drain(resampler_t* r)
+{
+    int pad = r->Filter.Taps/2;
+
+    if(r->Limit != UINT64_MAX)
+        return;
+    r->Limit = (uint64_t)ceil(r->Input/r->Step);
+    memset(r->Buffer+r->Length*r->Channels,0,pad*r->Channels*sizeof(float));
+    r->Length += pad;
+}
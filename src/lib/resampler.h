@@ -0,0 +1,45 @@
+#ifndef RESAMPLER_H_INCLUDED
+#define RESAMPLER_H_INCLUDED
+
+#include <stdint.h>
+
+#include "fir.h"
+
+// Streaming sample rate converter for interleaved float frames, using a
+// polyphase FIR filter. Input is added with resampler_write and output
+// is taken with resampler_read, output frame n is at input position
+// n*inrate/outrate (the filter is centered, there is no delay).
+typedef struct {
+
+    fir_t Filter;
+    int Channels;
+
+    double Step;     // input frames per output frame
+    double Pos;      // filter window position of the next output frame
+
+    uint64_t Input;  // input frames written
+    uint64_t Output; // output frames read
+    uint64_t Limit;  // output frames available after resampler_drain
+
+    float* Buffer;
+    int Size;        // buffer capacity in frames
+    int Length;      // frames in buffer
+
+} resampler_t;
+
+// quality presets for resampler_init
+enum {
+    RESAMPLER_LOW = 1,
+    RESAMPLER_MEDIUM,
+    RESAMPLER_HIGH,
+    RESAMPLER_QUALITY_COUNT
+};
+
+int  resampler_init(resampler_t* r, double inrate, double outrate, int channels, int quality);
+void resampler_destroy(resampler_t* r);
+
+int  resampler_write(resampler_t* r, const float* in, int frames);
+int  resampler_read(resampler_t* r, float* out, int frames);
+void resampler_drain(resampler_t* r);
+
+#endif // RESAMPLER_H_INCLUDED
@@ -0,0 +1,92 @@
+/*
+    Lock-free SPSC ring buffer
+*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "ring.h"
+
+// the producer publishes data with a release store of the write position,
+// the consumer frees space with a release store of the read position.
+#define RING_LOAD(x) __atomic_load_n(&(x),__ATOMIC_ACQUIRE)
+#define RING_STORE(x,v) __atomic_store_n(&(x),(v),__ATOMIC_RELEASE)
+
+// Allocate a ring holding at least 'size' floats. Returns -1 on failure.
+int ring_init(ring_t* ring, uint32_t size)
+{
+    uint32_t s = 1;
+    while(s < size)
+        s <<= 1;
+
+    ring->data = (float*)calloc(s,sizeof(float));
+    if(!ring->data)
+        return -1;
+    ring->size = s;
+    ring->mask = s-1;
+    ring->read = 0;
+    ring->write = 0;
+    return 0;
+}
+
+void ring_destroy(ring_t* ring)
+{
+    free(ring->data);
+    ring->data = NULL;
+    ring->size = 0;
+}
+
+// Only safe when neither side is active.
+void ring_reset(ring_t* ring)
+{
+    ring->read = 0;
+    ring->write = 0;
+}
+
+uint32_t ring_readable(ring_t* ring)
+{
+    return RING_LOAD(ring->write) - RING_LOAD(ring->read);
+}
+
+uint32_t ring_writable(ring_t* ring)
+{
+    return ring->size - ring_readable(ring);
+}
+
+// Read up to 'count' floats. Returns the number read.
+uint32_t ring_read(ring_t* ring, float* data, uint32_t count)
+{
+    uint32_t r = ring->read;
+    uint32_t avail = RING_LOAD(ring->write) - r;
+    if(count > avail)
+        count = avail;
+
+    uint32_t pos = r & ring->mask;
+    uint32_t first = ring->size - pos;
+    if(first > count)
+        first = count;
+    memcpy(data,&ring->data[pos],first*sizeof(float));
+    memcpy(data+first,ring->data,(count-first)*sizeof(float));
+
+    RING_STORE(ring->read,r+count);
+    return count;
+}
+
+// Write up to 'count' floats. Returns the number written.
+uint32_t ring_write(ring_t* ring, float* data, uint32_t count)
+{
+    uint32_t w = ring->write;
+    uint32_t space = ring->size - (w - RING_LOAD(ring->read));
+    if(count > space)
+        count = space;
+
+    uint32_t pos = w & ring->mask;
+    uint32_t first = ring->size - pos;
+    if(first > count)
+        first = count;
+    memcpy(&ring->data[pos],data,first*sizeof(float));
+    memcpy(ring->data,data+first,(count-first)*sizeof(float));
+
+    RING_STORE(ring->write,w+count);
+    return count;
+}
@@ -0,0 +1,30 @@
+#ifndef RING_H_INCLUDED
+#define RING_H_INCLUDED
+
+#include <stdint.h>
+
+// Lock-free single producer, single consumer ring buffer of floats.
+// One thread may call ring_write while another calls ring_read.
+typedef struct {
+
+    float* data;
+
+    uint32_t size; // capacity in floats (power of two)
+    uint32_t mask;
+
+    uint32_t read;  // free running positions, only written by the
+    uint32_t write; // consumer and producer respectively
+
+} ring_t;
+
+int  ring_init(ring_t* ring, uint32_t size);
+void ring_destroy(ring_t* ring);
+void ring_reset(ring_t* ring);
+
+uint32_t ring_readable(ring_t* ring);
+uint32_t ring_writable(ring_t* ring);
+
+uint32_t ring_read(ring_t* ring, float* data, uint32_t count);
+uint32_t ring_write(ring_t* ring, float* data, uint32_t count);
+
+#endif // RING_H_INCLUDED
@@ -0,0 +1,93 @@
+/*
+    State blob helpers
+*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "state.h"
+
+void state_init(state_t* s, uint8_t* data, uint32_t size)
+{
+    s->data = data;
+    s->size = data ? size : 0;
+    s->pos = 0;
+    s->error = 0;
+}
+
+void state_write(state_t* s, const void* src, uint32_t size)
+{
+    if(s->pos+size <= s->size)
+        memcpy(s->data+s->pos,src,size);
+    s->pos += size;
+}
+
+void state_read(state_t* s, void* dst, uint32_t size)
+{
+    if(s->error || s->pos+size > s->size)
+    {
+        s->error = 1;
+        return;
+    }
+    memcpy(dst,s->data+s->pos,size);
+    s->pos += size;
+}
+
+// Stored as (zero count, value count, values...) runs.
+void state_write_sparse(state_t* s, const uint32_t* src, uint32_t count)
+{
+    uint32_t i = 0, zero, len;
+
+    while(i < count)
+    {
+        zero = 0;
+        while(i+zero < count && !src[i+zero])
+            zero++;
+        i += zero;
+        len = 0;
+        while(i+len < count && src[i+len])
+            len++;
+
+        state_write(s,&zero,sizeof(zero));
+        state_write(s,&len,sizeof(len));
+        state_write(s,src+i,len*sizeof(*src));
+        i += len;
+    }
+}
+
+void state_read_sparse(state_t* s, uint32_t* dst, uint32_t count)
+{
+    uint32_t i = 0, zero, len;
+
+    while(i < count && !s->error)
+    {
+        zero = len = 0;
+        state_read(s,&zero,sizeof(zero));
+        state_read(s,&len,sizeof(len));
+        if(i+zero+len > count || i+zero+len <= i)
+        {
+            s->error = 1;
+            return;
+        }
+        memset(dst+i,0,zero*sizeof(*dst));
+        i += zero;
+        state_read(s,dst+i,len*sizeof(*dst));
+        i += len;
+    }
+}
+
+void* state_ptr_save(const void* base, uint32_t size, const void* ptr)
+{
+    uintptr_t b = (uintptr_t)base, p = (uintptr_t)ptr;
+    if(!ptr || p < b || p >= b+size)
+        return NULL;
+    return (void*)(p-b+1);
+}
+
+void* state_ptr_load(void* base, uint32_t size, const void* ptr)
+{
+    uintptr_t p = (uintptr_t)ptr;
+    if(!p || p > size)
+        return NULL;
+    return (uint8_t*)base+p-1;
+}
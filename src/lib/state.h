@@ -0,0 +1,36 @@
+#ifndef STATE_H_INCLUDED
+#define STATE_H_INCLUDED
+
+#include <stdint.h>
+
+// Serialized state blob. When writing, pos keeps counting past the end of
+// the buffer (or with data = NULL) so the required size can be found.
+// When reading, error is set if the blob is too short.
+typedef struct {
+
+    uint8_t* data;
+    uint32_t size;
+    uint32_t pos;
+    int error;
+
+} state_t;
+
+void state_init(state_t* s, uint8_t* data, uint32_t size);
+
+void state_write(state_t* s, const void* src, uint32_t size);
+void state_read(state_t* s, void* dst, uint32_t size);
+
+// Zero-run compressed arrays for large, mostly empty tables
+void state_write_sparse(state_t* s, const uint32_t* src, uint32_t count);
+void state_read_sparse(state_t* s, uint32_t* dst, uint32_t count);
+
+// Pointers into a struct are stored as offsets from the start of the struct
+// (plus one, 0 = NULL) so the blob can be loaded into another instance.
+// Pointers outside the struct are stored as NULL.
+void* state_ptr_save(const void* base, uint32_t size, const void* ptr);
+void* state_ptr_load(void* base, uint32_t size, const void* ptr);
+
+#define STATE_PTR_SAVE(_base,_ptr) (_ptr) = state_ptr_save(_base,sizeof(*(_base)),_ptr)
+#define STATE_PTR_LOAD(_base,_ptr) (_ptr) = state_ptr_load(_base,sizeof(*(_base)),_ptr)
+
+#endif // STATE_H_INCLUDED
@@ -0,0 +1,143 @@
+/*
+    Portable thread helpers
+*/
+#include <stdlib.h>
+
+#ifndef WIN32
+#include <unistd.h>
+#endif
+
+#include "thread.h"
+
+typedef struct {
+    int (*func)(void*);
+    void* data;
+} thread_start_t;
+
+#ifdef WIN32
+static DWORD WINAPI thread_start(LPVOID arg)
+#else
+static void* thread_start(void* arg)
+#endif
+{
+    thread_start_t s = *(thread_start_t*)arg;
+    free(arg);
+    s.func(s.data);
+    return 0;
+}
+
+int thread_create(qp_thread_t* thread, int (*func)(void*), void* data)
+{
+    thread_start_t* s = malloc(sizeof(thread_start_t));
+    if(!s)
+        return -1;
+    s->func = func;
+    s->data = data;
+#ifdef WIN32
+    *thread = CreateThread(NULL,0,thread_start,s,0,NULL);
+    if(*thread)
+        return 0;
+#else
+    if(!pthread_create(thread,NULL,thread_start,s))
+        return 0;
+#endif
+    free(s);
+    return -1;
+}
+
+void thread_join(qp_thread_t* thread)
+{
+#ifdef WIN32
+    WaitForSingleObject(*thread,INFINITE);
+    CloseHandle(*thread);
+#else
+    pthread_join(*thread,NULL);
+#endif
+}
+
+// Number of online processors, at least 1.
+int thread_cpu_count()
+{
+    int count;
+#ifdef WIN32
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    count = si.dwNumberOfProcessors;
+#else
+    count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return count < 1 ? 1 : count;
+}
+
+void mutex_init(qp_mutex_t* mutex)
+{
+#ifdef WIN32
+    InitializeCriticalSection(mutex);
+#else
+    pthread_mutex_init(mutex,NULL);
+#endif
+}
+
+void mutex_lock(qp_mutex_t* mutex)
+{
+#ifdef WIN32
+    EnterCriticalSection(mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+void mutex_unlock(qp_mutex_t* mutex)
+{
+#ifdef WIN32
+    LeaveCriticalSection(mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+void mutex_destroy(qp_mutex_t* mutex)
+{
+#ifdef WIN32
+    DeleteCriticalSection(mutex);
+#else
+    pthread_mutex_destroy(mutex);
+#endif
+}
+
+void cond_init(qp_cond_t* cond)
+{
+#ifdef WIN32
+    InitializeConditionVariable(cond);
+#else
+    pthread_cond_init(cond,NULL);
+#endif
+}
+
+// Wait for cond_signal, the mutex must be locked.
+void cond_wait(qp_cond_t* cond, qp_mutex_t* mutex)
+{
+#ifdef WIN32
+    SleepConditionVariableCS(cond,mutex,INFINITE);
+#else
+    pthread_cond_wait(cond,mutex);
+#endif
+}
+
+void cond_signal(qp_cond_t* cond)
+{
+#ifdef WIN32
+    WakeConditionVariable(cond);
+#else
+    pthread_cond_signal(cond);
+#endif
+}
+
+void cond_destroy(qp_cond_t* cond)
+{
+#ifdef WIN32
+    (void)cond;
+#else
+    pthread_cond_destroy(cond);
+#endif
+}
@@ -0,0 +1,31 @@
+#ifndef THREAD_H_INCLUDED
+#define THREAD_H_INCLUDED
+
+// Minimal portable threads (pthreads or Win32)
+#ifdef WIN32
+#include <windows.h>
+typedef HANDLE qp_thread_t;
+typedef CRITICAL_SECTION qp_mutex_t;
+typedef CONDITION_VARIABLE qp_cond_t;
+#else
+#include <pthread.h>
+typedef pthread_t qp_thread_t;
+typedef pthread_mutex_t qp_mutex_t;
+typedef pthread_cond_t qp_cond_t;
+#endif
+
+int  thread_create(qp_thread_t* thread, int (*func)(void*), void* data);
+void thread_join(qp_thread_t* thread);
+int  thread_cpu_count();
+
+void mutex_init(qp_mutex_t* mutex);
+void mutex_lock(qp_mutex_t* mutex);
+void mutex_unlock(qp_mutex_t* mutex);
+void mutex_destroy(qp_mutex_t* mutex);
+
+void cond_init(qp_cond_t* cond);
+void cond_wait(qp_cond_t* cond, qp_mutex_t* mutex);
+void cond_signal(qp_cond_t* cond);
+void cond_destroy(qp_cond_t* cond);
+
+#endif // THREAD_H_INCLUDED
@@ -16,24 +16,6 @@
 #define VGM_BUFFER 50000000
 #define VGM_MIDI_CHANNELS 8
 
-    uint32_t buffer_size;
-    uint32_t delayq;
-    uint32_t samplecnt;
-    uint32_t loop_set;
-    uint8_t* vgmdata;
-    uint8_t* data;
-    char* filename;
-    FILE* note_log;
-    int note_log_dirty;
-    char note_log_notes[32][4];
-    uint8_t* miditrack;
-    uint32_t midi_buffer_size;
-    uint32_t midi_track_size;
-    uint32_t midi_delta;
-    uint32_t midi_delta_rem;
-    uint8_t midi_note[32];
-    uint8_t midi_note_active[32];
-
 extern const char* Q_NoteNames[12];
 
 // Increments destination pointer
@@ -54,21 +36,21 @@ void add_datablockcmd(uint8_t** dest, uint8_t dtype, uint32_t size, uint32_t rom
     my_memcpy(dest,&offset,4);
 }
 
-static void midi_write_byte(uint8_t value)
+static void midi_write_byte(vgmfile_t* vgm, uint8_t value)
 {
-    if(midi_track_size >= midi_buffer_size)
+    if(vgm->midi_track_size >= vgm->midi_buffer_size)
     {
         uint8_t* temp;
-        temp = realloc(miditrack,midi_buffer_size*2);
+        temp = realloc(vgm->miditrack,vgm->midi_buffer_size*2);
         if(!temp)
             return;
-        miditrack = temp;
-        midi_buffer_size *= 2;
+        vgm->miditrack = temp;
+        vgm->midi_buffer_size *= 2;
     }
-    miditrack[midi_track_size++] = value;
+    vgm->miditrack[vgm->midi_track_size++] = value;
 }
 
-static void midi_write_varlen(uint32_t value)
+static void midi_write_varlen(vgmfile_t* vgm, uint32_t value)
 {
     uint32_t buffer = value & 0x7f;
     while((value >>= 7))
@@ -78,7 +60,7 @@ static void midi_write_varlen(uint32_t value)
     }
     while(1)
     {
-        midi_write_byte(buffer & 0xff);
+        midi_write_byte(vgm,buffer & 0xff);
         if(buffer & 0x80)
             buffer >>= 8;
         else
@@ -99,83 +81,82 @@ static uint8_t midi_channel_from_log_channel(int channel)
     return channel % VGM_MIDI_CHANNELS;
 }
 
-static void midi_write_event(uint8_t status, uint8_t data1, uint8_t data2)
+static void midi_write_event(vgmfile_t* vgm, uint8_t status, uint8_t data1, uint8_t data2)
 {
-    if(!miditrack)
+    if(!vgm->miditrack)
         return;
-    midi_write_varlen(midi_delta);
-    midi_write_byte(status);
-    midi_write_byte(data1);
-    midi_write_byte(data2);
-    midi_delta = 0;
+    midi_write_varlen(vgm,vgm->midi_delta);
+    midi_write_byte(vgm,status);
+    midi_write_byte(vgm,data1);
+    midi_write_byte(vgm,data2);
+    vgm->midi_delta = 0;
 }
 
-static void midi_add_delay(int samples)
+static void midi_add_delay(vgmfile_t* vgm, int samples)
 {
     uint32_t ticks;
-    if(!miditrack || samples <= 0)
+    if(!vgm->miditrack || samples <= 0)
         return;
-    midi_delta_rem += (uint32_t)samples * 960;
-    ticks = midi_delta_rem / 44100;
-    midi_delta_rem %= 44100;
-    midi_delta += ticks;
+    vgm->midi_delta_rem += (uint32_t)samples * 960;
+    ticks = vgm->midi_delta_rem / 44100;
+    vgm->midi_delta_rem %= 44100;
+    vgm->midi_delta += ticks;
 }
 
-static void midi_open(void)
+static void midi_open(vgmfile_t* vgm)
 {
-    midi_buffer_size = 0x10000;
-    midi_track_size = 0;
-    midi_delta = 0;
-    midi_delta_rem = 0;
-    memset(midi_note,0,sizeof(midi_note));
-    memset(midi_note_active,0,sizeof(midi_note_active));
-    miditrack = malloc(midi_buffer_size);
-    if(!miditrack)
+    vgm->midi_buffer_size = 0x10000;
+    vgm->midi_track_size = 0;
+    vgm->midi_delta = 0;
+    vgm->midi_delta_rem = 0;
+    memset(vgm->midi_note,0,sizeof(vgm->midi_note));
+    memset(vgm->midi_note_active,0,sizeof(vgm->midi_note_active));
+    vgm->miditrack = malloc(vgm->midi_buffer_size);
+    if(!vgm->miditrack)
         return;
 
     /* tempo: 120 bpm */
-    midi_write_varlen(0);
-    midi_write_byte(0xff);
-    midi_write_byte(0x51);
-    midi_write_byte(0x03);
-    midi_write_byte(0x07);
-    midi_write_byte(0xa1);
-    midi_write_byte(0x20);
+    midi_write_varlen(vgm,0);
+    midi_write_byte(vgm,0xff);
+    midi_write_byte(vgm,0x51);
+    midi_write_byte(vgm,0x03);
+    midi_write_byte(vgm,0x07);
+    midi_write_byte(vgm,0xa1);
+    midi_write_byte(vgm,0x20);
 }
 
-static void midi_note_off_all(void)
+static void midi_note_off_all(vgmfile_t* vgm)
 {
     int i;
     for(i=0;i<32;i++)
     {
-        if(midi_note_active[i])
+        if(vgm->midi_note_active[i])
         {
-            midi_write_event(0x80 | midi_channel_from_log_channel(i),midi_note[i],0);
-            midi_write_event(0x80 | (i & 0x0f),midi_note[i],0);
-            midi_note_active[i] = 0;
+            midi_write_event(vgm,0x80 | midi_channel_from_log_channel(i),vgm->midi_note[i],0);
+            vgm->midi_note_active[i] = 0;
         }
     }
 }
 
-static void midi_close(void)
+static void midi_close(vgmfile_t* vgm)
 {
     char* midiname;
     char* ext;
     FILE* midifile;
     uint32_t len;
 
-    if(!miditrack)
+    if(!vgm->miditrack)
         return;
 
-    midi_note_off_all();
-    midi_write_varlen(midi_delta);
-    midi_write_byte(0xff);
-    midi_write_byte(0x2f);
-    midi_write_byte(0x00);
-    midi_delta = 0;
+    midi_note_off_all(vgm);
+    midi_write_varlen(vgm,vgm->midi_delta);
+    midi_write_byte(vgm,0xff);
+    midi_write_byte(vgm,0x2f);
+    midi_write_byte(vgm,0x00);
+    vgm->midi_delta = 0;
 
-    midiname = (char*)malloc(strlen(filename)+10);
-    strcpy(midiname,filename);
+    midiname = (char*)malloc(strlen(vgm->filename)+10);
+    strcpy(midiname,vgm->filename);
     ext = strrchr(midiname,'.');
     if(ext != NULL)
         strcpy(ext,".mid");
@@ -191,47 +172,46 @@ static void midi_close(void)
         fputc(0x00,midifile); fputc(0x01,midifile);
         fputc(0x01,midifile); fputc(0xe0,midifile);
         fwrite("MTrk",1,4,midifile);
-        len = midi_track_size;
+        len = vgm->midi_track_size;
         fputc((len>>24)&0xff,midifile);
         fputc((len>>16)&0xff,midifile);
         fputc((len>>8)&0xff,midifile);
         fputc(len&0xff,midifile);
-        fwrite(miditrack,1,midi_track_size,midifile);
+        fwrite(vgm->miditrack,1,vgm->midi_track_size,midifile);
         fclose(midifile);
     }
     free(midiname);
-    free(miditrack);
-    miditrack = NULL;
+    free(vgm->miditrack);
+    vgm->miditrack = NULL;
 }
 
-static void vgm_note_log_write_header(void)
+static void vgm_note_log_write_header(vgmfile_t* vgm)
 {
     int i;
-    if(!note_log)
+    if(!vgm->note_log)
         return;
     for(i=0;i<32;i++)
-        fprintf(note_log,"Channel %-9d%s",i+1,(i == 31) ? "\n" : " ");
+        fprintf(vgm->note_log,"Channel %-9d%s",i+1,(i == 31) ? "\n" : " ");
 }
 
-static void vgm_note_log_flush(void)
+static void vgm_note_log_flush(vgmfile_t* vgm)
 {
     int i;
-    if(!note_log || !note_log_dirty)
+    if(!vgm->note_log || !vgm->note_log_dirty)
         return;
     for(i=0;i<32;i++)
-        fprintf(note_log,"%-17s%s",note_log_notes[i],(i == 31) ? "\n" : " ");
-    note_log_dirty = 0;
+        fprintf(vgm->note_log,"%-17s%s",vgm->note_log_notes[i],(i == 31) ? "\n" : " ");
+    vgm->note_log_dirty = 0;
 }
 
-void add_delay(uint8_t** dest, int delay)
+static void add_delay(vgmfile_t* vgm, uint8_t** dest, int delay)
 {
     if(delay > 0)
     {
-        vgm_note_log_flush();
-        midi_add_delay(delay);
+        vgm_note_log_flush(vgm);
+        midi_add_delay(vgm,delay);
     }
-        vgm_note_log_flush();
-    samplecnt += delay;
+    vgm->samplecnt += delay;
 
     int commandcount = floor(delay/65535);
     uint16_t finalcommand = delay%65535;
@@ -256,18 +236,23 @@ void add_delay(uint8_t** dest, int delay)
     }
 }
 
-void vgm_open(char* fname)
+vgmfile_t* vgm_open(char* fname)
 {
-    filename = (char*)malloc(strlen(fname)+10);
-    strcpy(filename,fname);
-    samplecnt=0;
-    delayq=0;
-    loop_set=0;
-    note_log = NULL;
-    note_log_dirty = 0;
-    memset(note_log_notes, 0, sizeof(note_log_notes));
-    miditrack = NULL;
-    midi_open();
+    vgmfile_t* vgm = (vgmfile_t*)malloc(sizeof(vgmfile_t));
+    if(!vgm)
+        return NULL;
+    memset(vgm,0,sizeof(vgmfile_t));
+
+    vgm->filename = (char*)malloc(strlen(fname)+10);
+    strcpy(vgm->filename,fname);
+    vgm->samplecnt=0;
+    vgm->delayq=0;
+    vgm->loop_set=0;
+    vgm->note_log = NULL;
+    vgm->note_log_dirty = 0;
+    memset(vgm->note_log_notes, 0, sizeof(vgm->note_log_notes));
+    vgm->miditrack = NULL;
+    midi_open(vgm);
 
     {
         char* txtname = (char*)malloc(strlen(fname)+10);
@@ -278,152 +263,148 @@ void vgm_open(char* fname)
             strcpy(ext,".txt");
         else
             strcat(txtname,".txt");
-        note_log = fopen(txtname,"w");
-        if(note_log)
-            vgm_note_log_write_header();
+        vgm->note_log = fopen(txtname,"w");
+        if(vgm->note_log)
+            vgm_note_log_write_header(vgm);
         free(txtname);
     }
 
     // create initial buffer
-    vgmdata=(uint8_t*)malloc(VGM_BUFFER);
-    data = vgmdata;
-    buffer_size = VGM_BUFFER;
-    memset(data, 0, VGM_BUFFER);
+    vgm->vgmdata=(uint8_t*)malloc(VGM_BUFFER);
+    if(!vgm->vgmdata)
+    {
+        if(vgm->note_log)
+            fclose(vgm->note_log);
+        free(vgm->miditrack);
+        free(vgm->filename);
+        free(vgm);
+        return NULL;
+    }
+    vgm->data = vgm->vgmdata;
+    vgm->buffer_size = VGM_BUFFER;
+    memset(vgm->data, 0, VGM_BUFFER);
 
     // vgm magic
-    memcpy(data, "Vgm ", 4);
+    memcpy(vgm->data, "Vgm ", 4);
 
     // version
-    data+=8;
-    *data++ = 0x71;
-    *data++ = 0x01;
+    vgm->data+=8;
+    *vgm->data++ = 0x71;
+    *vgm->data++ = 0x01;
 
     //data offset
-    *(uint32_t*)(vgmdata+0x34)=0x100-0x34;
+    *(uint32_t*)(vgm->vgmdata+0x34)=0x100-0x34;
 
-    data=vgmdata+0x100;
+    vgm->data=vgm->vgmdata+0x100;
+    return vgm;
 }
 
-void vgm_poke32(int32_t offset, uint32_t d)
+void vgm_poke32(vgmfile_t* vgm, int32_t offset, uint32_t d)
 {
-    *(uint32_t*)(vgmdata+offset)= d;
+    *(uint32_t*)(vgm->vgmdata+offset)= d;
 }
 
-void vgm_poke8(int32_t offset, uint8_t d)
+void vgm_poke8(vgmfile_t* vgm, int32_t offset, uint8_t d)
 {
-    *(uint8_t*)(vgmdata+offset)= d;
+    *(uint8_t*)(vgm->vgmdata+offset)= d;
 }
 
 // notice: start offset was replaced with ROM mask.
-void vgm_datablock(uint8_t dbtype, uint32_t dbsize, uint8_t* datablock, uint32_t maxsize, uint32_t mask, int32_t flags)
+void vgm_datablock(vgmfile_t* vgm, uint8_t dbtype, uint32_t dbsize, uint8_t* datablock, uint32_t maxsize, uint32_t mask, int32_t flags)
 {
-    add_datablockcmd(&data, dbtype, dbsize|flags, maxsize, 0);
+    add_datablockcmd(&vgm->data, dbtype, dbsize|flags, maxsize, 0);
 
     int i;
     for(i=0;i<dbsize;i++)
-        *data++ = datablock[i & mask];
+        *vgm->data++ = datablock[i & mask];
 
-    //my_memcpy(&data, datablock, dbsize);
+    //my_memcpy(&vgm->data, datablock, dbsize);
 }
 
-void vgm_setloop()
+void vgm_setloop(vgmfile_t* vgm)
 {
     // add delays
-    if(delayq/10 > 1)
+    if(vgm->delayq/10 > 1)
     {
-        add_delay(&data,delayq/10);
-        delayq=delayq%10;
+        add_delay(vgm,&vgm->data,vgm->delayq/10);
+        vgm->delayq=vgm->delayq%10;
     }
 
-    loop_set = samplecnt;
-    *(uint32_t*)(vgmdata+0x1c)= data-vgmdata-0x1c;
+    vgm->loop_set = vgm->samplecnt;
+    *(uint32_t*)(vgm->vgmdata+0x1c)= vgm->data-vgm->vgmdata-0x1c;
 }
 
-void vgm_write(uint8_t command, uint8_t port, uint16_t reg, uint16_t value)
+void vgm_write(vgmfile_t* vgm, uint8_t command, uint8_t port, uint16_t reg, uint16_t value)
 {
-    if(delayq/10 > 1)
+    if(vgm->delayq/10 > 1)
     {
-        add_delay(&data,delayq/10);
-        delayq=delayq%10;
+        add_delay(vgm,&vgm->data,vgm->delayq/10);
+        vgm->delayq=vgm->delayq%10;
     }
 
 // todo: need to handle command types if using other chips
-    *data++ = command;
+    *vgm->data++ = command;
 
     if(command == 0xe1) // C352
     {
-        *data++ = reg>>8;
-        *data++ = reg&0xff;
-        *data++ = value>>8;
-        *data++ = value&0xff;
+        *vgm->data++ = reg>>8;
+        *vgm->data++ = reg&0xff;
+        *vgm->data++ = value>>8;
+        *vgm->data++ = value&0xff;
     }
     else if(command == 0x54) // YM2151
     {
-        *data++ = reg;
-        *data++ = value;
+        *vgm->data++ = reg;
+        *vgm->data++ = value;
     }
     else // following is for D0-D6 commands...
     {
-        *data++ = port;
-        *data++ = (reg&0xff);
-        *data++ = (value&0xff);
+        *vgm->data++ = port;
+        *vgm->data++ = (reg&0xff);
+        *vgm->data++ = (value&0xff);
     }
 
     // resize buffer if needed
-    if(buffer_size-(data-vgmdata) < 1000000)
+    if(vgm->buffer_size-(vgm->data-vgm->vgmdata) < 1000000)
     {
         uint8_t* temp;
-        temp = realloc(vgmdata,buffer_size*2);
+        temp = realloc(vgm->vgmdata,vgm->buffer_size*2);
         if(temp)
         {
-            buffer_size *= 2;
-            data = temp+(data-vgmdata);
-            vgmdata = temp;
+            vgm->buffer_size *= 2;
+            vgm->data = temp+(vgm->data-vgm->vgmdata);
+            vgm->vgmdata = temp;
         }
     }
 }
 
 // delay is in VGM samples*10.
-void vgm_delay(uint32_t delay)
+void vgm_delay(vgmfile_t* vgm, uint32_t delay)
 {
-    delayq+=delay;
+    vgm->delayq+=delay;
 }
 
-void vgm_note_on(int channel, uint8_t note)
+void vgm_note_on(vgmfile_t* vgm, int channel, uint8_t note)
 {
     int octave;
     uint8_t midi_note_value;
     if(channel < 0 || channel >= 32)
         return;
     midi_note_value = midi_note_from_log_note(note);
-    midi_note_value = note;
     octave = (note-3)/12;
     note %= 12;
-    snprintf(note_log_notes[channel],sizeof(note_log_notes[channel]),"%s%d",Q_NoteNames[note],octave);
-    note_log_dirty = 1;
-    if(midi_note_active[channel] && midi_note[channel] == midi_note_value)
-        return;
-    if(midi_note_active[channel])
-        midi_write_event(0x80 | midi_channel_from_log_channel(channel),midi_note[channel],0);
-    midi_write_event(0x90 | midi_channel_from_log_channel(channel),midi_note_value,100);
-    midi_note[channel] = midi_note_value;
-    midi_note_active[channel] = 1;
-        midi_write_event(0x80 | (channel & 0x0f),midi_note[channel],0);
-    midi_write_event(0x90 | (channel & 0x0f),midi_note_value,100);
-    midi_note[channel] = midi_note_value;
-    midi_note_active[channel] = 1;
-    static const char* names[12] = {"A-","A#","B-","C-","C#","D-","D#","E-","F-","F#","G-","G#"};
-    int octave;
-    if(channel < 0 || channel >= 32)
+    snprintf(vgm->note_log_notes[channel],sizeof(vgm->note_log_notes[channel]),"%s%d",Q_NoteNames[note],octave);
+    vgm->note_log_dirty = 1;
+    if(vgm->midi_note_active[channel] && vgm->midi_note[channel] == midi_note_value)
         return;
-    octave = (note-3)/12;
-    note %= 12;
-    snprintf(note_log_notes[channel],sizeof(note_log_notes[channel]),"%s%d",Q_NoteNames[note],octave);
-    snprintf(note_log_notes[channel],sizeof(note_log_notes[channel]),"%s%d",names[note],octave);
-    note_log_dirty = 1;
+    if(vgm->midi_note_active[channel])
+        midi_write_event(vgm,0x80 | midi_channel_from_log_channel(channel),vgm->midi_note[channel],0);
+    midi_write_event(vgm,0x90 | midi_channel_from_log_channel(channel),midi_note_value,100);
+    vgm->midi_note[channel] = midi_note_value;
+    vgm->midi_note_active[channel] = 1;
 }
 
-void vgm_note_from_c352(int channel, uint16_t freq)
+void vgm_note_from_c352(vgmfile_t* vgm, int channel, uint16_t freq)
 {
     int note;
     if(freq == 0)
@@ -433,37 +414,36 @@ void vgm_note_from_c352(int channel, uint16_t freq)
         note = 0;
     if(note > 127)
         note = 127;
-    vgm_note_on(channel,(uint8_t)note);
+    vgm_note_on(vgm,channel,(uint8_t)note);
 }
 
-void vgm_note_off(int channel)
+void vgm_note_off(vgmfile_t* vgm, int channel)
 {
     if(channel < 0 || channel >= 32)
         return;
-    strcpy(note_log_notes[channel],"---");
-    note_log_dirty = 1;
-    if(midi_note_active[channel])
+    strcpy(vgm->note_log_notes[channel],"---");
+    vgm->note_log_dirty = 1;
+    if(vgm->midi_note_active[channel])
     {
-        midi_write_event(0x80 | midi_channel_from_log_channel(channel),midi_note[channel],0);
-        midi_write_event(0x80 | (channel & 0x0f),midi_note[channel],0);
-        midi_note_active[channel] = 0;
+        midi_write_event(vgm,0x80 | midi_channel_from_log_channel(channel),vgm->midi_note[channel],0);
+        vgm->midi_note_active[channel] = 0;
     }
 }
 
 // https://github.com/cppformat/cppformat/pull/130/files
-void gd3_write_string(char* s)
+static void gd3_write_string(vgmfile_t* vgm, char* s)
 {
     size_t l;
     #if defined(_WIN32) && defined(__MINGW32__) && !defined(__NO_ISOCEXT)
-        l = _snwprintf((wchar_t*)data,256,L"%S", s);
+        l = _snwprintf((wchar_t*)vgm->data,256,L"%S", s);
     #else
-        l = swprintf((wchar_t*)data,256,L"%s", s);
+        l = swprintf((wchar_t*)vgm->data,256,L"%s", s);
     #endif // defined
 
-    data += (l+1)*2;
+    vgm->data += (l+1)*2;
 }
 
-void vgm_write_tag(char* gamename,int songid)
+void vgm_write_tag(vgmfile_t* vgm, char* gamename,int songid)
 {
     time_t t;
     struct tm * tm;
@@ -478,57 +458,58 @@ void vgm_write_tag(char* gamename,int songid)
     strcpy(tracknotes+strlen(tracknotes),"Generated using QuattroPlay by ctr (Built "__DATE__" "__TIME__")");
 
     // Tag offset
-    *(uint32_t*)(vgmdata+0x14)= data-vgmdata-0x14;
-
-    memcpy(data, "Gd3 \x00\x01\x00\x00" , 8);
-    uint8_t* len_s = data+8;
-    data+=12;
-
-    gd3_write_string(""); // Track name
-    gd3_write_string(""); // Track name (native)
-    gd3_write_string(gamename); // Game name
-    gd3_write_string(""); // Game name (native)
-    gd3_write_string("Arcade Machine"); // System name
-    gd3_write_string(""); // System name (native)
-    gd3_write_string(""); // Author name
-    gd3_write_string(""); // Author name (native)
-    gd3_write_string(ts); // Time
-    gd3_write_string(""); // Pack author
-    gd3_write_string(tracknotes); // Notes
-
-    *(uint32_t*)(len_s) = data-len_s-4;        // length
+    *(uint32_t*)(vgm->vgmdata+0x14)= vgm->data-vgm->vgmdata-0x14;
+
+    memcpy(vgm->data, "Gd3 \x00\x01\x00\x00" , 8);
+    uint8_t* len_s = vgm->data+8;
+    vgm->data+=12;
+
+    gd3_write_string(vgm,""); // Track name
+    gd3_write_string(vgm,""); // Track name (native)
+    gd3_write_string(vgm,gamename); // Game name
+    gd3_write_string(vgm,""); // Game name (native)
+    gd3_write_string(vgm,"Arcade Machine"); // System name
+    gd3_write_string(vgm,""); // System name (native)
+    gd3_write_string(vgm,""); // Author name
+    gd3_write_string(vgm,""); // Author name (native)
+    gd3_write_string(vgm,ts); // Time
+    gd3_write_string(vgm,""); // Pack author
+    gd3_write_string(vgm,tracknotes); // Notes
+
+    *(uint32_t*)(len_s) = vgm->data-len_s-4;        // length
 }
 
-void vgm_stop()
+void vgm_stop(vgmfile_t* vgm)
 {
-    if(delayq/10 > 1)
+    if(vgm->delayq/10 > 1)
     {
-        add_delay(&data,delayq/10);
-        delayq=0;
+        add_delay(vgm,&vgm->data,vgm->delayq/10);
+        vgm->delayq=0;
     }
-    *data++ = 0x66;
+    *vgm->data++ = 0x66;
 
     // Sample count/loop sample count
-    *(uint32_t*)(vgmdata+0x18)= samplecnt;
-    if(loop_set)
-        *(uint32_t*)(vgmdata+0x20)= samplecnt-loop_set;
+    *(uint32_t*)(vgm->vgmdata+0x18)= vgm->samplecnt;
+    if(vgm->loop_set)
+        *(uint32_t*)(vgm->vgmdata+0x20)= vgm->samplecnt-vgm->loop_set;
 }
 
-void vgm_close()
+void vgm_close(vgmfile_t* vgm)
 {
-    vgm_note_log_flush();
+    vgm_note_log_flush(vgm);
     // EoF offset
-    *(uint32_t*)(vgmdata+0x04)= data-vgmdata-4;
+    *(uint32_t*)(vgm->vgmdata+0x04)= vgm->data-vgm->vgmdata-4;
 
-    write_file(filename, vgmdata, data-vgmdata);
+    write_file(vgm->filename, vgm->vgmdata, vgm->data-vgm->vgmdata, NULL);
 
-    if(note_log)
+    if(vgm->note_log)
     {
-        fclose(note_log);
-        note_log = NULL;
+        fclose(vgm->note_log);
+        vgm->note_log = NULL;
     }
-    midi_close();
+    midi_close(vgm);
 
-    free(vgmdata);
-    free(filename);
+    free(vgm->vgmdata);
+    free(vgm->filename);
+    free(vgm);
 }
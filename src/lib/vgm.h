@@ -1,23 +1,49 @@
 #ifndef VGM_H_INCLUDED
 #define VGM_H_INCLUDED
 
+#include <stdio.h>
 #include <stdint.h>
 
+// VGM writer state, including the note log and MIDI track written
+// alongside the VGM file.
+typedef struct {
+
+    uint32_t buffer_size;
+    uint32_t delayq;
+    uint32_t samplecnt;
+    uint32_t loop_set;
+    uint8_t* vgmdata;
+    uint8_t* data;
+    char* filename;
+
+    FILE* note_log;
+    int note_log_dirty;
+    char note_log_notes[32][4];
+
+    uint8_t* miditrack;
+    uint32_t midi_buffer_size;
+    uint32_t midi_track_size;
+    uint32_t midi_delta;
+    uint32_t midi_delta_rem;
+    uint8_t midi_note[32];
+    uint8_t midi_note_active[32];
+
+} vgmfile_t;
+
 // samplerom, samplelen, rom_offset
 //void vgm_open(char* fname, uint8_t* datablock, uint32_t dbsize, uint32_t startoffset);
-void vgm_open(char* fname);
-void vgm_write(uint8_t command, uint8_t port, uint16_t reg, uint16_t value);
-void vgm_delay(uint32_t delay);
-void vgm_setloop();
-void vgm_loop();
-void vgm_stop();
-void vgm_write_tag(char* gamename,int songid);
-void vgm_close();
-void vgm_note_on(int channel, uint8_t note);
-void vgm_note_off(int channel);
-void vgm_note_from_c352(int channel, uint16_t freq);
-void vgm_poke32(int32_t offset, uint32_t d);
-void vgm_poke8(int32_t offset, uint8_t d);
-void vgm_datablock(uint8_t dbtype, uint32_t dbsize, uint8_t* datablock, uint32_t maxsize, uint32_t mask, int32_t flags);
+vgmfile_t* vgm_open(char* fname);
+void vgm_write(vgmfile_t* vgm, uint8_t command, uint8_t port, uint16_t reg, uint16_t value);
+void vgm_delay(vgmfile_t* vgm, uint32_t delay);
+void vgm_setloop(vgmfile_t* vgm);
+void vgm_stop(vgmfile_t* vgm);
+void vgm_write_tag(vgmfile_t* vgm, char* gamename,int songid);
+void vgm_close(vgmfile_t* vgm);
+void vgm_note_on(vgmfile_t* vgm, int channel, uint8_t note);
+void vgm_note_off(vgmfile_t* vgm, int channel);
+void vgm_note_from_c352(vgmfile_t* vgm, int channel, uint16_t freq);
+void vgm_poke32(vgmfile_t* vgm, int32_t offset, uint32_t d);
+void vgm_poke8(vgmfile_t* vgm, int32_t offset, uint8_t d);
+void vgm_datablock(vgmfile_t* vgm, uint8_t dbtype, uint32_t dbsize, uint8_t* datablock, uint32_t maxsize, uint32_t mask, int32_t flags);
 
 #endif // VGM_H_INCLUDED
@@ -0,0 +1,96 @@
+/*
+    Wav file writer
+*/
+#include <stdio.h>
+#include <stdint.h>
+
+#include "wav.h"
+
+#define WAV_HEADER_SIZE 58
+
+int wav_open(char* filename, wavfile_t* wav, int channels, int rate)
+{
+    wav->channels = channels;
+    wav->rate = rate;
+    wav->samples = 0;
+    wav->f = fopen(filename,"wb");
+    if(!wav->f)
+        return -1;
+
+    // header is written when the file is closed.
+    int i;
+    for(i=0;i<WAV_HEADER_SIZE;i++)
+        putc(0,wav->f);
+
+    return 0;
+}
+
+void wav_write(wavfile_t* wav, float* data, int samplecnt)
+{
+    if(!wav->f)
+        return;
+    fwrite(data,wav->channels*4,samplecnt,wav->f);
+    wav->samples += samplecnt;
+}
+
+// Write sample frames at a position, for writing blocks out of order.
+// Any gap before pos is filled with silence when the file is closed.
+void wav_write_at(wavfile_t* wav, uint32_t pos, float* data, int samplecnt)
+{
+    if(!wav->f)
+        return;
+    fseek(wav->f,WAV_HEADER_SIZE+(long)pos*wav->channels*4,SEEK_SET);
+    fwrite(data,wav->channels*4,samplecnt,wav->f);
+    if(pos+samplecnt > wav->samples)
+        wav->samples = pos+samplecnt;
+}
+
+void wav_close(wavfile_t* wav)
+{
+    FILE* f = wav->f;
+    if(!f)
+        return;
+
+    uint32_t a;
+
+    uint32_t c = wav->channels;
+    uint32_t b = wav->rate;
+    uint32_t d = 4; // bytes per sample
+
+    uint32_t samplecount = wav->samples * c;
+    uint32_t chunksize = samplecount * d;
+    uint32_t chunksize2 = chunksize+50;
+
+    fseek(f,0,SEEK_SET);
+    fwrite("RIFF",4,1,f);           // ms id
+    fwrite(&chunksize2,4,1,f);      // file size - 8
+
+    fwrite("WAVE",4,1,f);           // Format id
+
+    fwrite("fmt ",4,1,f);           // chunk id
+    a=18;                           // chunk size
+    fwrite(&a,4,1,f);
+    a=3;                            // audio format (Float)
+    fwrite(&a,2,1,f);
+    fwrite(&c,2,1,f);               // amount of channels
+    fwrite(&b,4,1,f);               // sample rate
+    a=d*c*b;                        // bytes per second
+    fwrite(&a,4,1,f);
+    a=d*c;                          // bytes per sample
+    fwrite(&a,2,1,f);
+    a=d*8;                          // bits per sample
+    fwrite(&a,2,1,f);
+    a=0;                            // extension
+    fwrite(&a,2,1,f);
+
+    fwrite("fact",4,1,f);           // chunk id
+    a=4;                            // chunk size
+    fwrite(&a,4,1,f);
+    fwrite(&samplecount,4,1,f);     // sample count
+
+    fwrite("data",4,1,f);           // chunk id
+    fwrite(&chunksize,4,1,f);       // data size
+
+    fclose(f);
+    wav->f = NULL;
+}
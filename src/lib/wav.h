@@ -0,0 +1,23 @@
+#ifndef WAV_H_INCLUDED
+#define WAV_H_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+
+// 32-bit float wav file writer.
+typedef struct {
+
+    FILE * f;
+
+    uint32_t channels;
+    uint32_t rate;
+    uint32_t samples; // sample frames written
+
+} wavfile_t;
+
+int  wav_open(char* filename, wavfile_t* wav, int channels, int rate);
+void wav_write(wavfile_t* wav, float* data, int samplecnt);
+void wav_write_at(wavfile_t* wav, uint32_t pos, float* data, int samplecnt);
+void wav_close(wavfile_t* wav);
+
+#endif // WAV_H_INCLUDED
@@ -8,6 +8,7 @@
 #include <math.h>
 #include <string.h>
 #include <ctype.h>
+#include <errno.h>
 
 #ifdef WIN32
 #include "windows.h"
@@ -15,14 +16,17 @@
 #include "libgen.h"
 #endif // WIN32
 
-#include "SDL2/SDL.h"
-
 #include "qp.h"
-#include "legacy.h"
+#include "drv/quattro.h"
 
 #include "lib/vgm.h"
 #include "lib/ini.h"
 #include "lib/fileio.h"
+#include "lib/hash.h"
+
+char QP_IniPath[128];
+char QP_WavePath[128];
+char QP_DataPath[128];
 
 static int rom_deinterleave(QP_Game *G)
 {
@@ -60,16 +64,16 @@ char* my_realpath(char* filepath)
 
 // Loads game ini, then the sound data and wave roms...
 // this is a huge and messy function and needs to be replaced.
-int LoadGame(QP_Game *G)
+int LoadGame(QP_Context *ctx)
 {
-    //Q_State* Q = G->QDrv;
+    QP_Game *G = ctx->Game;
 
-    static char msgstring[1024];
-    static char *filename;
-    static char *path;
-    //static char gamehackname[128];
-    static char wave0[16];
-    static char wave1[16];
+    char *msgstring = G->ErrorMessage;
+    char *filename;
+    char *path;
+    //char gamehackname[128];
+    char wave0[16];
+    char wave1[16];
 
     int byteswap = 0;
     int interleave=0;
@@ -97,13 +101,13 @@ int LoadGame(QP_Game *G)
     unsigned int action_reg = 0;
     unsigned int action_data = 0;
 
-    static int patchtype[64];
-    static int patchaddr[64];
-    static int patchdata[64];
+    int patchtype[64];
+    int patchaddr[64];
+    int patchdata[64];
 
-    static char wave_filename[16][128];
-    static char data_filename[16][128];
-    static char driver_name[128];
+    char wave_filename[16][128];
+    char data_filename[16][128];
+    char driver_name[128];
 
     char *ini_realpath = 0;
 
@@ -297,11 +301,10 @@ int LoadGame(QP_Game *G)
     if(initest.status)
     {
         if(initest.status == INI_FILE_LOAD_ERROR)
-            strcat(msgstring,my_strerror(filename));
+            my_strerror(msgstring,sizeof(G->ErrorMessage),filename,strerror(errno));
         else
             strcat(msgstring,ini_error[initest.status]);
 
-        SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR,"Error",msgstring,NULL);
         ini_close(&initest);
 
         free(filename);
@@ -312,6 +315,16 @@ int LoadGame(QP_Game *G)
     ini_close(&initest);
 
     int i;
+    uint8_t *inidata;
+    uint32_t inisize;
+    char fileerr[FILEIO_ERROR_SIZE];
+
+    G->Hash = HASH_INIT;
+    if(!load_file(filename,&inidata,&inisize,NULL))
+    {
+        G->Hash = hash_data(G->Hash,inidata,inisize);
+        free(inidata);
+    }
 
     if(strlen(path) == 0)
         strcpy(path,G->Name);
@@ -336,13 +349,13 @@ int LoadGame(QP_Game *G)
     {
         data_size = G->DataSize-data_pos;
         snprintf(filename,127,"%s/%s/%s",QP_DataPath,path,data_filename[i]);
-        if(read_file(filename,G->Data+data_pos,0,0,byteswap,&data_size))
+        if(read_file(filename,G->Data+data_pos,0,0,byteswap,&data_size,NULL))
         {
             // try direct path too
             snprintf(filename,127,"%s/%s",ini_realpath,data_filename[i]);
-            if(read_file(filename,G->Data+data_pos,0,0,byteswap,&data_size))
+            if(read_file(filename,G->Data+data_pos,0,0,byteswap,&data_size,fileerr))
             {
-                strcat(msgstring,my_strerror(filename));
+                my_strerror(msgstring,sizeof(G->ErrorMessage),filename,fileerr);
             }
         }
 #ifdef DEBUG
@@ -407,15 +420,18 @@ int LoadGame(QP_Game *G)
 #endif
         wave_maxlen = 0x1000000 - wave_pos[i];
         snprintf(filename,127,"%s/%s/%s",QP_WavePath,path,wave_filename[i]);
-        if(read_file(filename,G->WaveData+wave_pos[i],wave_length[i],wave_offset[i],wave_byteswap[i],&wave_maxlen))
+        if(read_file(filename,G->WaveData+wave_pos[i],wave_length[i],wave_offset[i],wave_byteswap[i],&wave_maxlen,NULL))
         {
             snprintf(filename,127,"%s/%s",ini_realpath,wave_filename[i]);
-            if(read_file(filename,G->WaveData+wave_pos[i],wave_length[i],wave_offset[i],wave_byteswap[i],&wave_maxlen))
-                strcat(msgstring,my_strerror(filename));
+            if(read_file(filename,G->WaveData+wave_pos[i],wave_length[i],wave_offset[i],wave_byteswap[i],&wave_maxlen,fileerr))
+                my_strerror(msgstring,sizeof(G->ErrorMessage),filename,fileerr);
         }
         G->WaveMask |= wave_pos[i]+wave_length[i]-1;
     }
 
+    G->Hash = hash_data(G->Hash,G->Data,G->DataSize);
+    G->Hash = hash_data(G->Hash,G->WaveData,G->WaveMask+1);
+
     free(ini_realpath);
     free(filename);
     free(path);
@@ -426,12 +442,11 @@ int LoadGame(QP_Game *G)
 
     if(loadok != strlen(msgstring))
     {
-        SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR,"Error",msgstring,NULL);
         return -1;
     }
 
-    DriverInterface = (struct QP_DriverInterface*)malloc(sizeof(struct QP_DriverInterface));
-    memset(DriverInterface,0,sizeof(struct QP_DriverInterface));
+    ctx->DriverInterface = (struct QP_DriverInterface*)malloc(sizeof(struct QP_DriverInterface));
+    memset(ctx->DriverInterface,0,sizeof(struct QP_DriverInterface));
 
     for(i=0;driver_name[i];i++)
         driver_name[i] = tolower(driver_name[i]);
@@ -441,11 +456,8 @@ int LoadGame(QP_Game *G)
         if(!strcmp(driver_name,DriverTable[i].name))
         {
             printf("loading driver: %s\n",DriverTable[i].name);
-            if(DriverCreate(DriverInterface,i))
+            if(DriverCreate(ctx->DriverInterface,i))
                 break;
-            QDrv = NULL;
-            if(i == DRIVER_QUATTRO)
-                QDrv = DriverInterface->Driver;
             return 0;
         }
     }
@@ -453,45 +465,49 @@ int LoadGame(QP_Game *G)
         sprintf(msgstring,"%s Unable to find matching driver type for \"%s\"",msgstring,driver_name);
     else
         sprintf(msgstring,"%s Failed to create driver \"%s\"",msgstring,driver_name);
-    SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR,"Error",msgstring,NULL);
     return -1;
 }
 
-int UnloadGame(QP_Game *G)
+int UnloadGame(QP_Context *ctx)
 {
+    QP_Game *G = ctx->Game;
+    QP_CacheFree(G); // stops the cache scan thread, which uses the data
     if(G->Data)
         free(G->Data);
     if(G->WaveData)
         free(G->WaveData);
+    G->Data = NULL;
+    G->WaveData = NULL;
     //free(Q_Chip);
-    QDrv = NULL;
-    DriverDestroy(DriverInterface);
-    free(DriverInterface);
-    DriverInterface=0;
+    DriverDestroy(ctx->DriverInterface);
+    free(ctx->DriverInterface);
+    ctx->DriverInterface=0;
     return 0;
 }
 
-int InitGame(QP_Game *Game)
+// Initialize the sound driver and some initial playback parameters.
+// Does not touch the audio device, this is done by InitGame.
+int InitGameDriver(QP_Context *ctx)
 {
-    if(DriverInit())
+    QP_Game *Game = ctx->Game;
+
+    if(DriverInit(ctx))
     {
-        SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR,"Error","Failed to initialize driver",NULL);
+        strcpy(Game->ErrorMessage,"Failed to initialize driver");
         return -1;
     }
-    // Initialize sound chip and some initial sound driver parameters.
 
     Game->PlaylistPosition = 0;
     Game->PlaylistLoop = 0;
     Game->PlaylistControl = 0;
     Game->PlaylistSongID = 0;
     Game->ActionTimer = 0;
+    Game->Fadeout = 0;
+    ctx->TickTimer = 0;
 
-    static char filename[FILENAME_MAX];
-
-    char* audiodev = NULL;
-    if(strlen(Game->AudioDevice))
-        audiodev = Game->AudioDevice;
+    char filename[FILENAME_MAX];
 
+    ctx->Vgm = NULL;
     if(Game->VgmLog)
     {
         strcpy(filename,"qp_log.vgm");
@@ -499,73 +515,51 @@ int InitGame(QP_Game *Game)
         {
             sprintf(filename,"%s_%03x.vgm",Game->Name,Game->AutoPlay&0x7ff);
         }
-        vgm_open(filename);
+        ctx->Vgm = vgm_open(filename);
 
-        DriverInitVgm();
+        if(ctx->Vgm)
+            DriverInitVgm(ctx);
     }
 
     Game->QueueSong=Game->AutoPlay;
 
-    DriverReset(1);
-
-    if(QP_AudioInit(Audio,DriverGetChipRate(),Game->AudioBuffer,4,audiodev))
-    {
-        // we couldn't initialize audio with 4 channels, let's try 2 instead...
-        Game->Gain/=2; // you'll thank me for this
-        if(QP_AudioInit(Audio,DriverGetChipRate(),Game->AudioBuffer,2,audiodev))
-            return -1;
-    }
-
-    Audio->state.AutoPlaySong = Game->AutoPlay;
-    Audio->state.MuteRear = Game->MuteRear;
-    Audio->state.Gain = Game->BaseGain*Game->Gain;
-
-    if(Game->WavLog)
-    {
-        strcpy(filename,"qp_log.wav");
-        if(Game->AutoPlay >= 0)
-        {
-            sprintf(filename,"%s_%03x.wav",Game->Name,Game->AutoPlay&0x7ff);
-        }
-        QP_AudioWavOpen(Audio,filename);
-    }
+    DriverClearCommands(ctx);
+    QP_SeekClear(ctx,0);
+    ctx->TickCount = 0;
+    DriverReset(ctx,1);
 
     return 0;
 }
 
-void DeInitGame(QP_Game *Game)
+void DeInitGameDriver(QP_Context *ctx)
 {
-    if(Audio->state.FileLogging)
-    {
-        SDL_LockAudioDevice(Audio->dev);
-        QP_AudioWavClose(Audio);
-        SDL_UnlockAudioDevice(Audio->dev);
-    }
+    QP_Game *Game = ctx->Game;
 
-    if(Game->VgmLog)
+    if(ctx->Vgm)
     {
-        SDL_LockAudioDevice(Audio->dev);
-        DriverCloseVgm();
-        vgm_stop();
-        vgm_write_tag(strlen(Game->Title) ? Game->Title : Game->Name,Game->AutoPlay);
-        vgm_close();
-        SDL_UnlockAudioDevice(Audio->dev);
+        DriverCloseVgm(ctx);
+        vgm_stop(ctx->Vgm);
+        vgm_write_tag(ctx->Vgm,strlen(Game->Title) ? Game->Title : Game->Name,Game->AutoPlay);
+        vgm_close(ctx->Vgm);
+        ctx->Vgm = NULL;
     }
 
-    DriverDeinit();
+    DriverDeinit(ctx);
 }
 
-void ResetGame(QP_Game *Game)
+void ResetGame(QP_Context *ctx)
 {
-    DriverReset(0);
+    QP_Game *Game = ctx->Game;
+    DriverReset(ctx,0);
     Game->PlaylistControl=0;
     Game->Fadeout=0;
     Game->QueueSong=Game->AutoPlay;
 }
 
 // Perform register action (song triggers).
-void GameDoAction(QP_Game *G,unsigned int id)
+void GameDoAction(QP_Context *ctx,unsigned int id)
 {
+    QP_Game *G = ctx->Game;
     if(id > 255)
         return;
     int i,reg;
@@ -573,21 +567,22 @@ void GameDoAction(QP_Game *G,unsigned int id)
     {
         reg = G->Action[id].reg[i];
         if(reg<0x100)
-            DriverSetParameter(G->Action[id].reg[i],G->Action[id].data[i]);
+            DriverSetParameter(ctx,G->Action[id].reg[i],G->Action[id].data[i]);
         //G->QDrv->Register[G->Action[id].reg[i]&0xff] = G->Action[id].data[i];
         else if(reg<0x120)
-            DriverRequestSong(G->Action[id].reg[i]&0x1f,G->Action[id].data[i]&0x7ff);
+            DriverRequestSong(ctx,G->Action[id].reg[i]&0x1f,G->Action[id].data[i]&0x7ff);
         //G->QDrv->SongRequest[G->Action[id].reg[i]&0x1f] = G->Action[id].data[i];
     }
     return;
 }
 
-void GameDoUpdate(QP_Game *G)
+void GameDoUpdate(QP_Context *ctx)
 {
+    QP_Game *G = ctx->Game;
     int i;
 
     // todo...
-    if(DriverInterface->Type == DRIVER_QUATTRO && QDrv->BootSong != 0)
+    if(ctx->DriverInterface->Type == DRIVER_QUATTRO && ((Q_State*)ctx->DriverInterface->Driver)->BootSong != 0)
         return;
 
     if(!G->PlaylistControl)
@@ -600,7 +595,7 @@ void GameDoUpdate(QP_Game *G)
         int state = 0;
         int SongReq = G->PlaylistSongID & 0x800 ? 8 : 0;
 
-        int loopcnt = DriverGetLoopCount(SongReq);
+        int loopcnt = DriverGetLoopCount(ctx,SongReq);
 
         // time out
         if(S->wait_type == 2)
@@ -609,22 +604,22 @@ void GameDoUpdate(QP_Game *G)
             if(++G->PlaylistLoop > 1)
                 state = 1;
         }
-        if(S->wait_type == 1 && DriverGetPlayingTime(SongReq) > S->wait_count)
+        if(S->wait_type == 1 && DriverGetPlayingTime(ctx,SongReq) > S->wait_count)
             state=1;
         if(S->wait_type == 0 && loopcnt >= S->wait_count)
             state=1;
 
         // song is stopped
         //if((QDrv->SongRequest[SongReq]&0x8000) == 0)
-        if(!(DriverGetSongStatus(SongReq)&(SONG_STATUS_PLAYING|SONG_STATUS_STOPPING)))
+        if(!(DriverGetSongStatus(ctx,SongReq)&(SONG_STATUS_PLAYING|SONG_STATUS_STOPPING)))
             state=2;
 
         if(G->Fadeout>1)
         {
-            for(i=0;i<DriverGetSlotCount();i++)
-                DriverStopSong(i);
+            for(i=0;i<DriverGetSlotCount(ctx);i++)
+                DriverStopSong(ctx,i);
             for(i=0;i<15;i++)
-                DriverUpdateTick();
+                DriverUpdateTick(ctx);
             G->Fadeout=0;
         }
 
@@ -640,7 +635,7 @@ void GameDoUpdate(QP_Game *G)
             {
                 // do the previous action immediately...
                 if(G->ActionTimer)
-                    GameDoAction(G,G->QueueAction);
+                    GameDoAction(ctx,G->QueueAction);
                 Q_DEBUG("doing action %d...\n",S->action_id);
                 G->ActionTimer=20; // some songs don't like when actions are triggered immediately after loop...
                 G->QueueAction=S->action_id;
@@ -652,12 +647,12 @@ void GameDoUpdate(QP_Game *G)
                 G->PlaylistLoop=60;
                 //G->QDrv->SongRequest[SongReq]|=0x2000;
 
-                if(DriverInterface->Type == DRIVER_QUATTRO)
-                    DriverFadeOutSong(SongReq);
+                if(ctx->DriverInterface->Type == DRIVER_QUATTRO)
+                    DriverFadeOutSong(ctx,SongReq);
                 else
                     G->Fadeout+=0.01;
             }
-            DriverResetLoopCount();
+            DriverResetLoopCount(ctx);
             break;
         case 2:
             G->PlaylistLoop++;
@@ -665,7 +660,7 @@ void GameDoUpdate(QP_Game *G)
             {
                 // if all voices are silent, advance immediately.
                 // otherwise, we will wait half a second before advancing
-                if(DriverDetectSilence())
+                if(DriverDetectSilence(ctx))
                     break;
             }
             else if(G->PlaylistLoop<60)
@@ -688,11 +683,11 @@ void GameDoUpdate(QP_Game *G)
     {
         G->Fadeout=0;
 
-        for(i=0;i<DriverGetSlotCount();i++)
-            DriverStopSong(i);
+        for(i=0;i<DriverGetSlotCount(ctx);i++)
+            DriverStopSong(ctx,i);
 
         // driver may need to process the stop first
-        DriverUpdateTick();
+        DriverUpdateTick(ctx);
 
         G->QueueSong = G->Playlist[G->PlaylistPosition].SongID;
         G->PlaylistSongID = G->Playlist[G->PlaylistPosition].SongID;
@@ -701,13 +696,13 @@ void GameDoUpdate(QP_Game *G)
         G->PlaylistLoop = 0;
         G->ActionTimer = 0;
         if(G->Playlist[G->PlaylistPosition].Bank >= 0)
-            GameDoAction(G,G->Playlist[G->PlaylistPosition].Bank);
+            GameDoAction(ctx,G->Playlist[G->PlaylistPosition].Bank);
     }
 
     if(G->QueueSong >= 0)
     {
-        DriverResetLoopCount();
-        DriverRequestSong(G->QueueSong & 0x800 ? 8 : 0, G->QueueSong&0x7ff);
+        DriverResetLoopCount(ctx);
+        DriverRequestSong(ctx,G->QueueSong & 0x800 ? 8 : 0, G->QueueSong&0x7ff);
         //Q_LoopDetectionReset(G->QDrv);
         //G->QDrv->SongRequest[G->QueueSong & 0x800 ? 8 : 0] = 0x4000 | (G->QueueSong&0x7ff);
     }
@@ -715,7 +710,11 @@ void GameDoUpdate(QP_Game *G)
     G->QueueSong = -1;
 
     if(G->ActionTimer && --G->ActionTimer == 0)
-        GameDoAction(G,G->QueueAction);
+        GameDoAction(ctx,G->QueueAction);
+}
 
-    Audio->state.Gain = G->BaseGain*G->Gain*G->UIGain*(1-G->Fadeout);
+// Output gain, including playlist fadeout
+float GameGetGain(QP_Game *G)
+{
+    return G->BaseGain*G->Gain*G->UIGain*(1-G->Fadeout);
 }
@@ -3,6 +3,8 @@
 
 #include <stdint.h>
 
+#include "context.h"
+
 #define GAME_CONFIG_MAX 256
 
 typedef struct {
@@ -29,28 +31,37 @@ typedef struct {
     char data[48];
 } QP_GameConfig;
 
-typedef struct {
+typedef struct QP_Game {
 
     char Name[256]; // short name (filename-legal)
     char Title[1024]; // display title
     char Type[64]; // driver type
 
+    char ErrorMessage[1024]; // set when LoadGame or InitGameDriver fails
+
     uint8_t *Data;
     uint32_t DataSize;
     uint8_t *WaveData;
     uint32_t WaveMask;
+    uint64_t Hash; // hash of the game ini and ROM data, set by LoadGame
+
+    struct QP_Cache *Cache; // song metadata cache, see QP_CacheLoad
 
     //Q_State *QDrv;
 
     // audio configuration
     char AudioDevice[256];
     int AudioBuffer;
+    int RenderBuffer;
+    int OutputRate; // requested output sample rate (0 = chip rate)
+    int Resampler;  // output rate conversion quality (0 = repeat samples)
 
     // Global configuration
     int WavLog;
     int VgmLog;
     int AutoPlay;
     int PortaFix;
+    int FMResampler; // System 2 FM to PCM rate conversion (0 = linear interpolation)
     int BootSong;
     float BaseGain;
 
@@ -79,13 +90,15 @@ typedef struct {
     int ActionTimer;
 } QP_Game;
 
-int LoadGame(QP_Game *Game);
-int UnloadGame(QP_Game *Game);
+int LoadGame(QP_Context *ctx);
+int UnloadGame(QP_Context *ctx);
 
-int  InitGame(QP_Game *Game);
-void DeInitGame(QP_Game *Game);
+int  InitGameDriver(QP_Context *ctx);
+void DeInitGameDriver(QP_Context *ctx);
+void ResetGame(QP_Context *ctx);
 
-void GameDoAction(QP_Game *G,unsigned int actionid);
-void GameDoUpdate(QP_Game *G);
+void GameDoAction(QP_Context *ctx,unsigned int actionid);
+void GameDoUpdate(QP_Context *ctx);
+float GameGetGain(QP_Game *G);
 
 #endif // LOADER_H_INCLUDED
@@ -6,13 +6,20 @@
 #include "SDL2/SDL.h"
 
 #include "qp.h"
+#include "audio.h"
+#include "render.h"
+#include "batch.h"
 
 #include "lib/vgm.h"
 #include "lib/audit.h"
 #include "lib/ini.h"
+#include "lib/resampler.h"
 
 #include "ui/ui.h"
 
+QP_Context *Context;
+QP_Game *Game;
+
 static char* config_filename = "quattroplay.ini";
 static const char* default_config = "; QuattroPlay global configuration\n\
 [config]\n\
@@ -22,6 +29,8 @@ inipath  = ini\n\
 datapath = roms\n\
 ; Path to directory containing sample ROMs (subdirectory for each game)\n\
 wavepath = roms\n\
+; Path to directory where song lengths are cached. Leave empty to disable.\n\
+cachepath = cache\n\
 ; Default gain. This is multiplied with a game-specific setting.\n\
 gain     = 32.0\n\
 ; Default game name. Used if the game name is not supplied through command\n\
@@ -38,38 +47,88 @@ bootsong = 1\n\
 ; 0 = Reset pitch to 0\n\
 ; 1 = Reset pitch to A3 (220hz)\n\
 portafix = 0\n\
+; FM to PCM rate conversion for System 2/21 games.\n\
+; 0 = Linear interpolation (fastest)\n\
+; 1 = 16-tap FIR\n\
+; 2 = 32-tap FIR (best)\n\
+fmresampler = 0\n\
+; Output sample rate for playback and rendering, for example 44100, 48000\n\
+; or 96000. 0 = use the sound chip rate.\n\
+outputrate = 0\n\
+; Quality of the conversion to the output sample rate.\n\
+; 0 = Repeat samples (playback only, fastest)\n\
+; 1 = Low (16-tap FIR)\n\
+; 2 = Medium (32-tap FIR)\n\
+; 3 = High (64-tap FIR)\n\
+resampler = 2\n\
 ; Audio buffer size (default = 2048)\n\
 ; Set it to a higher value if you encounter audio issues.\n\
 audiobuffer = 2048\n\
+; Render-ahead buffer size (default = 4096)\n\
+; Audio is rendered ahead by a separate thread. Set it to a higher value if\n\
+; you still encounter audio issues with a small audio buffer. Higher values\n\
+; delay controls (fast forward, mute etc) a bit.\n\
+renderbuffer = 4096\n\
 ; Audio device name (https://wiki.libsdl.org/SDL_GetAudioDeviceName)\n\
 ; Leave this intact for now\n\
 ; audiodevice =\n";
 
+// print song length from a driver-only scan
+static int print_scan(QP_Context *ctx,double TimeLimit)
+{
+    QP_ScanResult r;
+    if(QP_Scan(ctx,-1,TimeLimit,&r))
+        return -1;
+
+    static const char* status[] = {"time limit reached","ends","loops"};
+    printf("song %03x %s\n",ctx->Game->AutoPlay&0x7ff,status[r.Status]);
+    if(r.Status == QP_SCAN_TIMEOUT)
+        return 0;
+    printf("%-6s %8d ticks %10d samples %10.3f s\n","intro",r.IntroTicks,r.IntroSamples,r.IntroSamples/r.ChipRate);
+    if(r.Status == QP_SCAN_LOOPED)
+        printf("%-6s %8d ticks %10d samples %10.3f s\n","loop",r.LoopTicks,r.LoopSamples,r.LoopSamples/r.ChipRate);
+    return 0;
+}
+
 int main(int argc, char *argv[])
 {
     int loop = 0;
     int val = 0;
-    SDL_Init(SDL_INIT_AUDIO|SDL_INIT_VIDEO|SDL_INIT_TIMER);
+    int render = 0;
+    int scan = 0;
+    int batch = 0;
+    int batch_all = 0;
+    int batch_count = 0;
+    char** batch_names;
+    QP_RenderOptions renderopt;
+    QP_BatchOptions batchopt;
+    QP_RenderDefaults(&renderopt);
+    QP_BatchDefaults(&batchopt);
 
     Audio = (QP_Audio*)malloc(sizeof(QP_Audio));
     memset(Audio,0,sizeof(QP_Audio));
 
-    Game = (QP_Game*)malloc(sizeof(QP_Game));
-    memset(Game,0,sizeof(QP_Game));
+    Context = QP_ContextCreate();
 
     Audit = (QP_Audit*)malloc(sizeof(QP_Audit));
     memset(Audit,0,sizeof(QP_Audit));
 
-    DriverInterface=0;
-
-    if(!Audio || !Game)
+    if(!Audio || !Context)
         return -1;
 
-    Game->AutoPlay = -1;
+    Game = Context->Game;
+
+    batch_names = (char**)malloc(argc*sizeof(char*));
+    if(!batch_names)
+        return -1;
 
     Game->MuteRear=0;
     Game->BaseGain=32.0;
     Game->AudioBuffer=1024;
+    Game->RenderBuffer=4096;
+    Game->OutputRate=0;
+    Game->Resampler=RESAMPLER_MEDIUM;
+    strcpy(QP_CachePath,"cache");
 
     FILE* f = NULL;
     f = fopen(config_filename,"r");
@@ -101,6 +160,8 @@ int main(int argc, char *argv[])
                     strcpy(QP_WavePath,initest.value);
                 else if(!strcmp(initest.key,"datapath"))
                     strcpy(QP_DataPath,initest.value);
+                else if(!strcmp(initest.key,"cachepath"))
+                    strcpy(QP_CachePath,initest.value);
                 else if(!strcmp(initest.key,"gamename"))
                     strcpy(Game->Name,initest.value);
                 else if(!strcmp(initest.key,"gain"))
@@ -109,10 +170,18 @@ int main(int argc, char *argv[])
                     Game->BootSong = atoi(initest.value);
                 else if(!strcmp(initest.key,"portafix"))
                     Game->PortaFix = atoi(initest.value);
+                else if(!strcmp(initest.key,"fmresampler"))
+                    Game->FMResampler = atoi(initest.value);
                 else if(!strcmp(initest.key,"audiodevice"))
                     strcpy(Game->AudioDevice,initest.value);
                 else if(!strcmp(initest.key,"audiobuffer"))
                     Game->AudioBuffer = atoi(initest.value);
+                else if(!strcmp(initest.key,"renderbuffer"))
+                    Game->RenderBuffer = atoi(initest.value);
+                else if(!strcmp(initest.key,"outputrate"))
+                    Game->OutputRate = atoi(initest.value);
+                else if(!strcmp(initest.key,"resampler"))
+                    Game->Resampler = atoi(initest.value);
             }
         }
         ini_close(&initest);
@@ -123,6 +192,9 @@ int main(int argc, char *argv[])
         return -1;
     }
 
+    renderopt.SampleRate = Game->OutputRate;
+    renderopt.Resampler = Game->Resampler;
+
     int i, standard_args=0;
     for(i=1;i<argc;i++)
     {
@@ -144,30 +216,178 @@ int main(int argc, char *argv[])
         {
             Game->VgmLog=1;
         }
+        else if(!strcmp(argv[i],"-r") || !strcmp(argv[i],"--render"))
+        {
+            render=1;
+        }
+        else if(!strcmp(argv[i],"--scan"))
+        {
+            scan=1;
+        }
+        else if((!strcmp(argv[i],"-o") || !strcmp(argv[i],"--output")) && i+1<argc)
+        {
+            i++;
+            strcpy(renderopt.Filename,argv[i]);
+        }
+        else if(!strcmp(argv[i],"--loops") && i+1<argc)
+        {
+            i++;
+            renderopt.Loops = atoi(argv[i]);
+        }
+        else if(!strcmp(argv[i],"--time") && i+1<argc)
+        {
+            i++;
+            renderopt.TimeLimit = atof(argv[i]);
+        }
+        else if(!strcmp(argv[i],"--fade") && i+1<argc)
+        {
+            i++;
+            renderopt.FadeTime = atof(argv[i]);
+        }
+        else if(!strcmp(argv[i],"--seek") && i+1<argc)
+        {
+            i++;
+            renderopt.SeekTime = atof(argv[i]);
+        }
+        else if(!strcmp(argv[i],"--stems"))
+        {
+            renderopt.Stems = 1;
+        }
+        else if(!strcmp(argv[i],"--fm-resampler") && i+1<argc)
+        {
+            i++;
+            Game->FMResampler = atoi(argv[i]);
+        }
+        else if(!strcmp(argv[i],"--rate") && i+1<argc)
+        {
+            i++;
+            renderopt.SampleRate = atoi(argv[i]);
+        }
+        else if(!strcmp(argv[i],"--resampler") && i+1<argc)
+        {
+            i++;
+            renderopt.Resampler = atoi(argv[i]);
+        }
+        else if(!strcmp(argv[i],"--no-chip-threads"))
+        {
+            renderopt.ChipThreads = 0;
+        }
+        else if(!strcmp(argv[i],"-b") || !strcmp(argv[i],"--batch"))
+        {
+            batch=1;
+        }
+        else if(!strcmp(argv[i],"--all"))
+        {
+            batch=1;
+            batch_all=1;
+        }
+        else if(!strcmp(argv[i],"--threads") && i+1<argc)
+        {
+            i++;
+            batchopt.Threads = renderopt.Threads = atoi(argv[i]);
+        }
         else
         {
+            // all arguments are game names in batch mode
+            batch_names[batch_count++] = argv[i];
             if(standard_args == 0)
                 strcpy(Game->Name, argv[i]);
             else if(standard_args == 1)
                 Game->AutoPlay = (int)strtol(argv[i],NULL,0);
-            else
-                break;
             standard_args++;
         }
 
     }
 
-    //Game->QDrv = QDrv;
+    // batch mode, render all playlist entries for the specified games
+    if(batch)
+    {
+        if(batch_all)
+        {
+            AuditGames(Audit);
+            AuditRoms(Audit);
+            batch_count = 0;
+            for(i=0;i<Audit->Count;i++)
+            {
+                if(!Audit->Entry[i].HasPlaylist)
+                    continue;
+                if(!Audit->Entry[i].RomOk)
+                    printf("'%s' has missing ROMs, skipping\n",Audit->Entry[i].Name);
+                else
+                    batch_names[batch_count++] = Audit->Entry[i].Name;
+            }
+        }
+
+        if(!batch_count)
+        {
+            printf("No games specified for rendering\n");
+            val = -1;
+        }
+        else
+        {
+            strcpy(batchopt.OutputPath,renderopt.Filename);
+            batchopt.Render.Loops = renderopt.Loops;
+            batchopt.Render.TimeLimit = renderopt.TimeLimit;
+            batchopt.Render.FadeTime = renderopt.FadeTime;
+            batchopt.Render.SampleRate = renderopt.SampleRate;
+            batchopt.Render.Resampler = renderopt.Resampler;
+            batchopt.Render.SeekTime = renderopt.SeekTime;
+            batchopt.Render.Stems = renderopt.Stems;
+            val = QP_Batch(Game,batch_names,batch_count,&batchopt) ? -1 : 0;
+        }
+
+        free(batch_names);
+        free(Audit);
+        free(Audio);
+        QP_ContextDestroy(Context);
+        return val;
+    }
+    free(batch_names);
+
+    // headless mode, render song to file without opening the audio device or UI
+    if(render || scan)
+    {
+        if(!strlen(Game->Name))
+        {
+            printf("No game specified for rendering\n");
+            val = -1;
+        }
+        else if(scan && Game->AutoPlay < 0)
+        {
+            printf("No song specified for scanning\n");
+            val = -1;
+        }
+        else
+        {
+            val = LoadGame(Context);
+            if(val)
+                printf("%s\n",Game->ErrorMessage);
+            else if(scan)
+                val = print_scan(Context,renderopt.TimeLimit);
+            else
+                val = QP_Render(Context,&renderopt);
+            UnloadGame(Context);
+        }
+
+        free(Audit);
+        free(Audio);
+        QP_ContextDestroy(Context);
+        return val;
+    }
 
     if(!strlen(Game->Name))
         loop=1;
 
+    SDL_Init(SDL_INIT_AUDIO|SDL_INIT_VIDEO|SDL_INIT_TIMER);
+
     if(ui_init())
     {
         SDL_Quit();
         return -1;
     }
 
+    QP_SeekEnable(Context,QP_SEEK_INTERVAL);
+
     while(1)
     {
         if(val == -1)
@@ -184,9 +404,14 @@ int main(int argc, char *argv[])
             else
                 strcpy(Game->Name,Audit->Entry[--val].Name);
         }
-        val = (LoadGame(Game) || InitGame(Game));
+        Game->ErrorMessage[0] = 0;
+        val = (LoadGame(Context) || QP_CacheLoad(Context) || InitGame(Context));
+        if(val && strlen(Game->ErrorMessage))
+            SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR,"Error",Game->ErrorMessage,NULL);
         if(!val)
         {
+            // song lengths are filled in while playing
+            QP_CacheScan(Context);
             QP_AudioSetPause(Audio,0);
             Audio->state.UpdateRequest = QPAUDIO_CHIP_PLAY|QPAUDIO_DRV_PLAY;
 
@@ -194,10 +419,10 @@ int main(int argc, char *argv[])
 
             QP_AudioClose(Audio);
 
-            // Audio must be closed or locked before calling this
-            DeInitGame(Game);
+            // Audio must be closed before calling this
+            DeInitGame(Context);
         }
-        UnloadGame(Game);
+        UnloadGame(Context);
 
         if(!loop && !val)
             break;
@@ -208,7 +433,7 @@ int main(int argc, char *argv[])
 
     free(Audit);
     free(Audio);
-    free(Game);
+    QP_ContextDestroy(Context);
 
     return 0;
 }
@@ -0,0 +1,33 @@
+/*
+    QuattroPlay library
+
+    Public header for libquattroplay (sound drivers, chip emulation, game
+    loading and rendering). The library has no SDL dependency.
+*/
+#ifndef QUATTROPLAY_H_INCLUDED
+#define QUATTROPLAY_H_INCLUDED
+
+#define QP_TITLE "QuattroPlay"
+#define QP_VERSION "2.0"
+#define QP_COPYRIGHT "2016-2017 Ian Karlsson"
+#define QP_LICENSE "GPL v2"
+#define QP_WEBSITE "https://github.com/superctr/QuattroPlay"
+
+#include "context.h"
+#include "driver.h"
+#include "loader.h"
+#include "render.h"
+#include "scan.h"
+#include "seek.h"
+#include "cache.h"
+#include "batch.h"
+#include "lib/audit.h"
+
+extern char QP_IniPath[128];
+extern char QP_WavePath[128];
+extern char QP_DataPath[128];
+extern char QP_CachePath[128];
+
+extern QP_Audit *Audit;
+
+#endif // QUATTROPLAY_H_INCLUDED
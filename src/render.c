@@ -0,0 +1,713 @@
+/*
+    Headless rendering
+
+    Runs the sound driver and chip emulation without the audio device or
+    user interface, and writes the output to a wav file.
+
+    With more than one thread, a driver-only pre-pass finds the song length
+    and saves driver state keyframes. The song is then split into segments
+    and each segment is rendered by a separate context. Since the pre-pass
+    does not run the sound chips, a voice that is playing in a keyframe
+    would restart from the beginning of its sample, and the chip envelopes
+    are stale. Segments therefore only start at keyframes where no voice is
+    playing, and rendering starts a few seconds earlier so that the chips
+    settle (the warm-up output is discarded). If the song has no silent
+    keyframes it is rendered as a single segment.
+
+    Serial renders can instead run the sound chips on separate threads
+    if the driver supports it (see DriverSetChipThreads), which gives the
+    same output.
+
+    If an output rate is set, the fadeout is applied at the chip rate and
+    the result is converted with a resampler before it is written.
+*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "qp.h"
+#include "render.h"
+#include "lib/wav.h"
+#include "lib/thread.h"
+#include "lib/resampler.h"
+
+#define RENDER_BUFFER_SIZE 1024
+
+#define RENDER_KEYFRAME_INTERVAL 1.0 // seconds between pre-pass keyframes, doubled when full
+#define RENDER_MAX_KEYFRAMES 256
+#define RENDER_MAX_SEGMENTS 64
+#define RENDER_MIN_SEGMENT 20.0     // minimum segment length in seconds
+#define RENDER_WARMUP 3.0           // seconds rendered and discarded before each segment
+
+void QP_RenderDefaults(QP_RenderOptions* opt)
+{
+    memset(opt,0,sizeof(*opt));
+    opt->PlaylistEntry = -1;
+    opt->Loops = 2;
+    opt->TimeLimit = 600;
+    opt->FadeTime = 5;
+    opt->ChipThreads = 1;
+    opt->Resampler = RESAMPLER_MEDIUM;
+}
+
+// State shared with the tick callback
+typedef struct {
+    QP_Game *G;
+    QP_RenderOptions *opt;
+    int entry;
+    int slot;
+    int started;
+    int stopped;
+    uint32_t samples; // samples written before the current block
+    uint32_t fade_start;
+    uint32_t fade_length;
+    uint32_t time_limit;
+    resampler_t* rs; // conversion to the output rate, NULL = chip rate
+} QP_RenderState;
+
+typedef struct {
+    uint32_t Position; // sample position
+    uint32_t Size;
+    uint8_t *Data;     // DriverStateSave blob
+    int Silent;        // no voices playing, segments can start here
+} QP_RenderKeyframe;
+
+// Segment-parallel render jobs
+typedef struct {
+    qp_mutex_t Lock;
+
+    QP_Context *Source;
+    QP_RenderState *Render;
+    wavfile_t *Wav;
+    int Channels;
+
+    int SegmentCount;
+    int NextSegment;
+    uint32_t Start[RENDER_MAX_SEGMENTS+1]; // segment positions, last = song length
+    QP_RenderKeyframe *Warmup[RENDER_MAX_SEGMENTS]; // keyframe to start rendering from
+
+    int KeyframeCount;
+    uint32_t Interval; // samples between keyframes
+    QP_RenderKeyframe Keyframe[RENDER_MAX_KEYFRAMES];
+
+    int Errors;
+} QP_RenderSegments;
+
+// Check stop conditions after each driver tick
+static int render_tick(QP_Context* ctx, void* data, int offset)
+{
+    QP_RenderState *r = data;
+    QP_Game *G = r->G;
+    uint32_t pos = r->samples+offset;
+
+    int status = DriverGetSongStatus(ctx,r->slot);
+    if(status & SONG_STATUS_PLAYING)
+        r->started = 1;
+
+    if(!r->fade_start)
+    {
+        if(r->entry < 0 && r->opt->Loops && DriverGetLoopCount(ctx,r->slot) >= r->opt->Loops)
+            r->fade_start = pos;
+        else if(r->time_limit && pos >= r->time_limit)
+            r->fade_start = pos;
+        if(r->fade_start && !r->fade_length)
+            r->stopped = 1;
+    }
+
+    // the playlist script handles loops and fadeout, stop when it
+    // advances to the next entry.
+    if(r->entry >= 0)
+    {
+        if(!G->PlaylistControl || G->PlaylistPosition != r->entry)
+            r->stopped = 1;
+    }
+    // song has ended, stop when all voices are silent.
+    else if(r->started && !(status&(SONG_STATUS_PLAYING|SONG_STATUS_STOPPING)) && !DriverDetectSilence(ctx))
+        r->stopped = 1;
+
+    return r->stopped;
+}
+
+// Apply the fadeout to a block starting at r->samples. Returns the number
+// of frames to write, less than count if the fadeout has ended.
+static int render_fade(QP_RenderState* r, float* buffer, int count, int channels)
+{
+    int i, j;
+
+    if(!r->fade_start)
+        return count;
+
+    for(i=0;i<count;i++)
+    {
+        uint32_t pos = r->samples+i;
+        if(pos < r->fade_start)
+            continue;
+
+        uint32_t fade_pos = pos-r->fade_start;
+        if(fade_pos >= r->fade_length)
+        {
+            r->stopped = 1;
+            return i+1;
+        }
+        float fade = 1.0-((double)fade_pos/r->fade_length);
+        for(j=0;j<channels;j++)
+            buffer[i*channels+j] *= fade;
+    }
+    return count;
+}
+
+// Write chip rate frames, converted to the output rate if rs is not NULL.
+static void render_write(wavfile_t* wav, resampler_t* rs, float* data, int count)
+{
+    float buffer[RENDER_BUFFER_SIZE*4];
+    int n, done = 0;
+
+    if(!rs)
+    {
+        wav_write(wav,data,count);
+        return;
+    }
+    while(done < count)
+    {
+        done += resampler_write(rs,data+done*rs->Channels,count-done);
+        while((n = resampler_read(rs,buffer,RENDER_BUFFER_SIZE)) > 0)
+            wav_write(wav,buffer,n);
+    }
+}
+
+// write the rest of the resampler output
+static void render_drain(wavfile_t* wav, resampler_t* rs)
+{
+    float buffer[RENDER_BUFFER_SIZE*4];
+    int n;
+
+    if(!rs)
+        return;
+    resampler_drain(rs);
+    while((n = resampler_read(rs,buffer,RENDER_BUFFER_SIZE)) > 0)
+        wav_write(wav,buffer,n);
+}
+
+static void render_serial(QP_Context* ctx, QP_RenderState* r, wavfile_t* wav, int channels)
+{
+    float buffer[RENDER_BUFFER_SIZE*4];
+    int count;
+
+    while(!r->stopped)
+    {
+        count = DriverRender(ctx,buffer,RENDER_BUFFER_SIZE,channels);
+        count = render_fade(r,buffer,count,channels);
+
+        render_write(wav,r->rs,buffer,count);
+        r->samples += count;
+    }
+    render_drain(wav,r->rs);
+}
+
+// Render the mix and each stem to separate files in the same pass. Stems
+// that stay silent are deleted.
+static int render_stems(QP_Context* ctx, QP_RenderState* r, wavfile_t* wav, int channels, char* filename)
+{
+    float buffer[RENDER_BUFFER_SIZE*4];
+    float* stems[QP_MAX_STEMS];
+    wavfile_t* stemwav;
+    resampler_t* stemrs = NULL;
+    char* stemfile;
+    char name[16];
+    int used[QP_MAX_STEMS];
+    int i, j, count, stemcount = DriverGetStemCount(ctx);
+    int ret = 0;
+
+    if(stemcount > QP_MAX_STEMS)
+        stemcount = QP_MAX_STEMS;
+    if(!stemcount)
+    {
+        printf("The sound driver does not support stems\n");
+        return -1;
+    }
+
+    stemwav = (wavfile_t*)calloc(stemcount,sizeof(wavfile_t));
+    stemfile = (char*)calloc(stemcount,FILENAME_MAX);
+    stems[0] = (float*)malloc(stemcount*RENDER_BUFFER_SIZE*4*sizeof(float));
+    if(r->rs)
+        stemrs = (resampler_t*)calloc(stemcount,sizeof(resampler_t));
+    if(!stemwav || !stemfile || !stems[0] || (r->rs && !stemrs))
+    {
+        free(stemwav);
+        free(stemfile);
+        free(stems[0]);
+        free(stemrs);
+        return -1;
+    }
+
+    // <filename without .wav>_<stem name>.wav
+    memset(used,0,sizeof(used));
+    j = strlen(filename);
+    if(j > 4 && !strcmp(filename+j-4,".wav"))
+        j -= 4;
+    for(i=0;i<stemcount;i++)
+    {
+        stems[i] = stems[0]+i*RENDER_BUFFER_SIZE*4;
+        DriverGetStemName(ctx,i,name,sizeof(name));
+        snprintf(stemfile+i*FILENAME_MAX,FILENAME_MAX,"%.*s_%s.wav",j,filename,name);
+        if(wav_open(stemfile+i*FILENAME_MAX,&stemwav[i],channels,wav->rate))
+        {
+            printf("Could not open '%s' for writing\n",stemfile+i*FILENAME_MAX);
+            ret = -1;
+            break;
+        }
+        if(stemrs && resampler_init(&stemrs[i],DriverGetChipRate(ctx),wav->rate,channels,r->opt->Resampler))
+        {
+            printf("Could not create resampler\n");
+            ret = -1;
+            break;
+        }
+    }
+
+    if(!ret)
+        printf("writing %d stems\n",stemcount);
+
+    while(!ret && !r->stopped)
+    {
+        QP_RenderState fade = *r;
+
+        count = DriverRenderStems(ctx,buffer,stems,RENDER_BUFFER_SIZE,channels);
+        count = render_fade(r,buffer,count,channels);
+        render_write(wav,r->rs,buffer,count);
+
+        for(i=0;i<stemcount;i++)
+        {
+            QP_RenderState stemfade = fade;
+            render_fade(&stemfade,stems[i],count,channels);
+            for(j=0;!used[i] && j<count*channels;j++)
+                used[i] = stems[i][j] != 0;
+            render_write(&stemwav[i],stemrs ? &stemrs[i] : NULL,stems[i],count);
+        }
+        r->samples += count;
+    }
+
+    render_drain(wav,r->rs);
+    for(i=0;i<stemcount;i++)
+    {
+        if(!stemwav[i].f)
+            continue; // not opened because of an error
+        if(!ret && stemrs)
+            render_drain(&stemwav[i],&stemrs[i]);
+        wav_close(&stemwav[i]);
+        if(!used[i])
+            remove(stemfile+i*FILENAME_MAX);
+        if(stemrs)
+            resampler_destroy(&stemrs[i]);
+    }
+
+    free(stemrs);
+    free(stemwav);
+    free(stemfile);
+    free(stems[0]);
+    return ret;
+}
+
+// drop every other keyframe when the list is full
+static void render_thin_keyframes(QP_RenderSegments* S)
+{
+    int i;
+    for(i=0;i<S->KeyframeCount;i++)
+    {
+        if(i&1)
+            free(S->Keyframe[i].Data);
+        else
+            S->Keyframe[i/2] = S->Keyframe[i];
+    }
+    S->KeyframeCount = (S->KeyframeCount+1)/2;
+    S->Interval *= 2;
+}
+
+// true if the driver has no voices playing
+static int render_is_silent(QP_Context* ctx)
+{
+    struct QP_DriverVoiceInfo vi;
+    int i;
+
+    for(i=0;i<DriverGetVoiceCount(ctx);i++)
+    {
+        if(!DriverGetVoiceInfo(ctx,i,&vi) && vi.Status & VOICE_STATUS_PLAYING)
+            return 0;
+    }
+    return 1;
+}
+
+static int render_save_keyframe(QP_RenderSegments* S, QP_Context* ctx, uint32_t pos)
+{
+    QP_RenderKeyframe* f;
+
+    if(S->KeyframeCount == RENDER_MAX_KEYFRAMES)
+        render_thin_keyframes(S);
+
+    f = &S->Keyframe[S->KeyframeCount];
+    f->Position = pos;
+    f->Silent = !pos || render_is_silent(ctx); // the song start is always exact
+    f->Size = DriverStateSave(ctx,NULL,0);
+    f->Data = (uint8_t*)malloc(f->Size);
+    if(!f->Size || !f->Data || DriverStateSave(ctx,f->Data,f->Size) != f->Size)
+    {
+        free(f->Data);
+        return -1;
+    }
+    S->KeyframeCount++;
+    return 0;
+}
+
+// Run the driver only to find the song length and save keyframes. Each
+// DriverRender call ends at a keyframe position, so the saved state resumes
+// exactly as if rendering had continued.
+static int render_prepass(QP_Context* ctx, QP_RenderState* r, QP_RenderSegments* S, int channels)
+{
+    int count;
+
+    while(!r->stopped)
+    {
+        if(!(r->samples % S->Interval) && render_save_keyframe(S,ctx,r->samples))
+            return -1;
+
+        count = DriverRender(ctx,NULL,S->Interval - r->samples % S->Interval,channels);
+
+        // same stop position as render_fade
+        if(r->fade_start && r->samples+count > r->fade_start+r->fade_length)
+        {
+            count = r->fade_start+r->fade_length+1-r->samples;
+            r->stopped = 1;
+        }
+        r->samples += count;
+    }
+    return 0;
+}
+
+// last keyframe at or before pos, if silent is set only silent keyframes
+// are considered (the first keyframe is always silent)
+static QP_RenderKeyframe* render_find_keyframe(QP_RenderSegments* S, uint32_t pos, int silent)
+{
+    int i;
+    for(i=S->KeyframeCount-1;i>0;i--)
+        if(S->Keyframe[i].Position <= pos && (S->Keyframe[i].Silent || !silent))
+            break;
+    return &S->Keyframe[i];
+}
+
+// Split the song into segments starting at silent keyframes. Segments
+// without a silent keyframe in between are merged. Returns the number of
+// segments before merging.
+static int render_split(QP_RenderSegments* S, uint32_t length, int count, double ChipRate)
+{
+    uint32_t warmup = RENDER_WARMUP*ChipRate;
+    uint32_t start;
+    int i, max, n = 1;
+
+    max = length / (RENDER_MIN_SEGMENT*ChipRate);
+    if(count > max)
+        count = max;
+    if(count > RENDER_MAX_SEGMENTS)
+        count = RENDER_MAX_SEGMENTS;
+    if(count < 1)
+        count = 1;
+
+    S->Start[0] = 0;
+    S->Warmup[0] = &S->Keyframe[0];
+    for(i=1;i<count;i++)
+    {
+        start = render_find_keyframe(S,(uint64_t)length*i/count,1)->Position;
+        if(start <= S->Start[n-1])
+            continue;
+        S->Start[n] = start;
+        S->Warmup[n] = render_find_keyframe(S,start > warmup ? start-warmup : 0,0);
+        n++;
+    }
+    S->SegmentCount = n;
+    S->Start[n] = length;
+    return count;
+}
+
+// Create a context for rendering segments, sharing the game data with src.
+static QP_Context* render_create_context(QP_Context* src)
+{
+    QP_Context* ctx = QP_ContextCreate();
+    if(!ctx)
+        return NULL;
+
+    memcpy(ctx->Game,src->Game,sizeof(QP_Game));
+    ctx->Game->VgmLog = 0;
+    ctx->Game->Cache = NULL;
+
+    ctx->DriverInterface = (struct QP_DriverInterface*)calloc(1,sizeof(struct QP_DriverInterface));
+    if(!ctx->DriverInterface || DriverCreate(ctx->DriverInterface,src->DriverInterface->Type))
+    {
+        free(ctx->DriverInterface);
+        QP_ContextDestroy(ctx);
+        return NULL;
+    }
+    if(InitGameDriver(ctx))
+    {
+        DriverDestroy(ctx->DriverInterface);
+        free(ctx->DriverInterface);
+        QP_ContextDestroy(ctx);
+        return NULL;
+    }
+    DriverSetMute(ctx,DriverGetMute(src));
+    DriverSetSolo(ctx,DriverGetSolo(src));
+    return ctx;
+}
+
+static void render_destroy_context(QP_Context* ctx)
+{
+    DeInitGameDriver(ctx);
+    DriverDestroy(ctx->DriverInterface);
+    free(ctx->DriverInterface);
+    QP_ContextDestroy(ctx);
+}
+
+static int render_segment(QP_Context* ctx, QP_RenderSegments* S, int id)
+{
+    float buffer[RENDER_BUFFER_SIZE*4];
+    QP_RenderState r = *S->Render;
+    QP_RenderKeyframe* f = S->Warmup[id];
+    uint32_t pos = f->Position, start = S->Start[id], end = S->Start[id+1];
+    int count, skip, channels = S->Channels;
+
+    if(DriverStateLoad(ctx,f->Data,f->Size))
+        return -1;
+
+    while(pos < end)
+    {
+        count = end-pos;
+        if(count > RENDER_BUFFER_SIZE)
+            count = RENDER_BUFFER_SIZE;
+        DriverRender(ctx,buffer,count,channels);
+
+        // discard the warm-up
+        skip = 0;
+        if(pos < start)
+            skip = start-pos < (uint32_t)count ? (int)(start-pos) : count;
+
+        if(skip < count)
+        {
+            r.samples = pos+skip;
+            int n = render_fade(&r,buffer+skip*channels,count-skip,channels);
+            mutex_lock(&S->Lock);
+            wav_write_at(S->Wav,pos+skip,buffer+skip*channels,n);
+            mutex_unlock(&S->Lock);
+        }
+        pos += count;
+    }
+    return 0;
+}
+
+static int render_worker(void* data)
+{
+    QP_RenderSegments* S = data;
+    QP_Context* ctx = render_create_context(S->Source);
+    int id;
+
+    if(!ctx)
+    {
+        mutex_lock(&S->Lock);
+        S->Errors++;
+        mutex_unlock(&S->Lock);
+        return -1;
+    }
+
+    for(;;)
+    {
+        mutex_lock(&S->Lock);
+        id = S->NextSegment++;
+        mutex_unlock(&S->Lock);
+        if(id >= S->SegmentCount)
+            break;
+        if(render_segment(ctx,S,id))
+        {
+            mutex_lock(&S->Lock);
+            S->Errors++;
+            mutex_unlock(&S->Lock);
+        }
+    }
+
+    render_destroy_context(ctx);
+    return 0;
+}
+
+static int render_parallel(QP_Context* ctx, QP_RenderState* r, wavfile_t* wav, int channels, int count)
+{
+    QP_RenderSegments* S = (QP_RenderSegments*)calloc(1,sizeof(QP_RenderSegments));
+    qp_thread_t* threads = (qp_thread_t*)malloc(count*sizeof(qp_thread_t));
+    double ChipRate = DriverGetChipRate(ctx);
+    int i;
+
+    if(!S || !threads)
+    {
+        free(S);
+        free(threads);
+        return -1;
+    }
+
+    S->Source = ctx;
+    S->Render = r;
+    S->Wav = wav;
+    S->Channels = channels;
+    S->Interval = RENDER_KEYFRAME_INTERVAL*ChipRate;
+
+    if(render_prepass(ctx,r,S,channels))
+    {
+        printf("Could not save driver state\n");
+        S->Errors++;
+    }
+    else
+    {
+        i = render_split(S,r->samples,count,ChipRate);
+        if(count > S->SegmentCount)
+            count = S->SegmentCount;
+
+        if(S->SegmentCount == 1 && i > 1)
+            printf("no silent points to split the song at, rendering serially\n");
+        else
+            printf("rendering %d segments using %d threads\n",S->SegmentCount,count);
+
+        mutex_init(&S->Lock);
+        for(i=0;i<count;i++)
+        {
+            if(thread_create(&threads[i],render_worker,S))
+                break;
+        }
+        if(i == 0)
+            render_worker(S);
+        count = i;
+        for(i=0;i<count;i++)
+            thread_join(&threads[i]);
+        mutex_destroy(&S->Lock);
+
+        if(S->Errors)
+            printf("%d segments could not be rendered\n",S->Errors);
+    }
+
+    i = S->Errors;
+    while(S->KeyframeCount)
+        free(S->Keyframe[--S->KeyframeCount].Data);
+    free(S);
+    free(threads);
+    return i ? -1 : 0;
+}
+
+int QP_Render(QP_Context* ctx, QP_RenderOptions* opt)
+{
+    QP_Game *G = ctx->Game;
+    char filename[FILENAME_MAX];
+
+    wavfile_t wav;
+    QP_RenderState r;
+
+    int i, ret = 0;
+    int channels = G->MuteRear ? 2 : 4;
+
+    memset(&r,0,sizeof(r));
+    r.G = G;
+    r.opt = opt;
+    r.entry = opt->PlaylistEntry;
+
+    if(r.entry >= G->SongCount)
+    {
+        printf("Playlist entry %d does not exist\n",r.entry+1);
+        return -1;
+    }
+    else if(r.entry >= 0)
+        G->AutoPlay = G->Playlist[r.entry].SongID;
+    else if(G->AutoPlay < 0)
+    {
+        printf("No song specified for rendering\n");
+        return -1;
+    }
+
+    r.slot = G->AutoPlay & 0x800 ? 8 : 0;
+
+    if(InitGameDriver(ctx))
+    {
+        printf("%s\n",G->ErrorMessage);
+        return -1;
+    }
+
+    // let the playlist script handle song start, actions and fadeout
+    if(r.entry >= 0)
+    {
+        G->QueueSong = -1;
+        G->PlaylistPosition = r.entry;
+        G->PlaylistControl = 2;
+    }
+
+    G->UIGain = 1.0;
+
+    if(opt->SeekTime > 0)
+        QP_Seek(ctx,opt->SeekTime*DriverGetTickRate(ctx));
+
+    double ChipRate = DriverGetChipRate(ctx);
+    double OutRate = ChipRate;
+    resampler_t rs;
+
+    r.fade_length = opt->FadeTime*ChipRate;
+    r.time_limit = opt->TimeLimit*ChipRate;
+
+    if(opt->SampleRate > 0 && fabs(opt->SampleRate-ChipRate) >= 0.5)
+    {
+        if(resampler_init(&rs,ChipRate,opt->SampleRate,channels,opt->Resampler))
+        {
+            printf("Could not create resampler\n");
+            DeInitGameDriver(ctx);
+            return -1;
+        }
+        r.rs = &rs;
+        OutRate = opt->SampleRate;
+    }
+
+    if(strlen(opt->Filename))
+        strcpy(filename,opt->Filename);
+    else
+        sprintf(filename,"%s_%03x.wav",G->Name,G->AutoPlay&0x7ff);
+
+    if(wav_open(filename,&wav,channels,OutRate))
+    {
+        printf("Could not open '%s' for writing\n",filename);
+        if(r.rs)
+            resampler_destroy(r.rs);
+        DeInitGameDriver(ctx);
+        return -1;
+    }
+
+    printf("rendering song %03x to '%s' (%d Hz, %d channels)\n",G->AutoPlay&0x7ff,filename,(int)OutRate,channels);
+
+    ctx->TickFunc = render_tick;
+    ctx->TickData = &r;
+
+    if(opt->Threads > 1 && r.rs && !opt->Stems)
+        printf("Parallel rendering is not supported with resampling, rendering serially\n");
+
+    if(opt->Stems)
+        ret = render_stems(ctx,&r,&wav,channels,filename);
+    else if(opt->Threads > 1 && !r.rs)
+        ret = render_parallel(ctx,&r,&wav,channels,opt->Threads);
+    else
+    {
+        if(opt->ChipThreads && thread_cpu_count() > 1)
+            DriverSetChipThreads(ctx,1);
+        render_serial(ctx,&r,&wav,channels);
+        DriverSetChipThreads(ctx,0);
+    }
+
+    ctx->TickFunc = NULL;
+    ctx->TickData = NULL;
+
+    wav_close(&wav);
+    if(r.rs)
+        resampler_destroy(r.rs);
+    DeInitGameDriver(ctx);
+
+    i = r.samples/ChipRate;
+    printf("wrote %d samples (%d:%02d)\n",r.samples,i/60,i%60);
+    return ret;
+}
@@ -0,0 +1,30 @@
+#ifndef RENDER_H_INCLUDED
+#define RENDER_H_INCLUDED
+
+#include <stdio.h>
+
+#include "loader.h"
+
+// Headless rendering options
+typedef struct {
+
+    char Filename[FILENAME_MAX]; // output filename, default = <gamename>_<songid>.wav
+
+    int PlaylistEntry;  // render this playlist entry instead of G->AutoPlay (-1 = disabled)
+
+    int Loops;          // fade out after this many loops (0 = ignore, not used for playlist entries)
+    double TimeLimit;   // fade out after this many seconds (0 = ignore)
+    double FadeTime;    // fadeout length in seconds
+    double SeekTime;    // start rendering at this time (seconds)
+    int Threads;        // render segments of the song in parallel (0/1 = serial, exact)
+    int Stems;          // also write each voice to <filename>_<stem>.wav (serial only)
+    int ChipThreads;    // render the sound chips on separate threads (serial only, exact)
+    int SampleRate;     // output sample rate (0 = chip rate, forces a serial render otherwise)
+    int Resampler;      // resampler quality, see resampler_init
+
+} QP_RenderOptions;
+
+void QP_RenderDefaults(QP_RenderOptions* opt);
+int  QP_Render(QP_Context* ctx, QP_RenderOptions* opt);
+
+#endif // RENDER_H_INCLUDED
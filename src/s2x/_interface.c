@@ -3,6 +3,7 @@
 #include <math.h>
 
 #include "../qp.h"
+#include "../lib/thread.h"
 #include "../lib/vgm.h"
 
 #include "s2x.h"
@@ -14,18 +15,62 @@
 #define SYSTEM1 (S->ConfigFlags & S2X_CFG_SYSTEM1)
 #define SYSTEMNA (S->DriverType == S2X_TYPE_NA)
 
+#define S2X_RENDER_BLOCK 256 // frames per C352_render call (the FM rate is lower)
+#define S2X_STEM_BLOCK 64
+#define S2X_STEM_COUNT (C352_VOICES+8)
+
+static void S2X_FMThreadStop(S2X_State *S);
+
+// FM resampler presets (QP_Game.FMResampler), the first is linear
+// interpolation. Cutoff is relative to the YM2151 rate.
+static const struct {
+    int Taps;
+    double Cutoff;
+    double Beta;
+} S2X_FMResamplers[] = {
+    {0},
+    {16, 0.45, 7.0},
+    {32, 0.47, 9.0},
+};
+#define S2X_FM_RESAMPLER_COUNT (int)(sizeof(S2X_FMResamplers)/sizeof(S2X_FMResamplers[0]))
+#define S2X_FIR_PHASES 128
+
+static void S2X_SetFMResampler(S2X_State *S,int id)
+{
+    if(S->FMFilter)
+    {
+        fir_destroy(S->FMFilter);
+        free(S->FMFilter);
+        S->FMFilter = NULL;
+    }
+    S2X_ClearFMHistory(S);
+
+    if(id <= 0 || id >= S2X_FM_RESAMPLER_COUNT)
+        return;
+
+    S->FMFilter = (fir_t*)malloc(sizeof(fir_t));
+    if(!S->FMFilter || fir_init(S->FMFilter,S2X_FMResamplers[id].Taps,S2X_FIR_PHASES,2,
+                                S2X_FMResamplers[id].Cutoff,S2X_FMResamplers[id].Beta))
+    {
+        Q_DEBUG("could not create the FM resampler, using linear interpolation\n");
+        free(S->FMFilter);
+        S->FMFilter = NULL;
+    }
+}
+
 int S2X_IInit(void* d,QP_Game *g)
 {
     S2X_State* S = d;
 
     S2X_ReadConfig(S,g);
 
+    C352_cache_disable(&S->PCMChip);
     memset(&S->PCMChip,0,sizeof(C352));
     memset(&S->FMChip,0,sizeof(YM2151));
 
     S->PCMClock = SYSTEMNA ? 50113000/2 : 49152000/2; // sound chip freq is master clock / 2
     C352_init(&S->PCMChip,S->PCMClock);
-    S->PCMChip.vgm_log = 0;
+    S->PCMChip.vgm = NULL;
     if(SYSTEMNA)
     {
         S->PCMChip.wave = g->Data;
@@ -36,13 +81,21 @@ int S2X_IInit(void* d,QP_Game *g)
         C352_set_mulaw_type(&S->PCMChip,C352_MULAW_TYPE_C140);
         S->PCMChip.wave = g->WaveData;
         S->PCMChip.wave_mask = g->WaveMask;
+        // not for System NA, the address mask is larger than the data
+        C352_cache_enable(&S->PCMChip,C352_CACHE_SIZE);
     }
     S->Data = g->Data;
+    S->DataSize = g->DataSize;
 
     S->FMClock = 3579545;
     S->FMTicks = 0;
     S->FMWriteTicks = 0;
+    S->FMTime = 0;
+    S->FMWriteTime = 0;
+    S->FMTickTime = 0;
+    S2X_OPMClearQueue(S);
     YM2151_init(&S->FMChip,S->FMClock);
+    S2X_SetFMResampler(S,g->FMResampler);
 
     S->SoundRate = S->PCMChip.rate;
     S->FMDelta = S->FMChip.rate / S->SoundRate;
@@ -55,9 +108,13 @@ int S2X_IInit(void* d,QP_Game *g)
 void S2X_IDeinit(void* d)
 {
     S2X_State* S = d;
+    S2X_FMThreadStop(S);
+    S2X_SetFMResampler(S,0);
+    C352_cache_disable(&S->PCMChip);
+    S2X_OPMFreeQueue(S);
     S2X_Deinit(S);
 }
-void S2X_IVgmOpen(void* d)
+void S2X_IVgmOpen(void* d,vgmfile_t* vgm)
 {
     S2X_State* S = d;
 
@@ -67,17 +124,17 @@ void S2X_IVgmOpen(void* d)
         S2X_WSGLoadWave(S);
     }
 
-    vgm_datablock(0x92,0x1000000,S->PCMChip.wave,0x1000000,S->PCMChip.wave_mask,0);
-    S->PCMChip.vgm_log = 1;
+    vgm_datablock(vgm,0x92,0x1000000,S->PCMChip.wave,0x1000000,S->PCMChip.wave_mask,0);
+    S->PCMChip.vgm = vgm;
 }
-void S2X_IVgmClose(void* d)
+void S2X_IVgmClose(void* d,QP_Game *g)
 {
     S2X_State* S = d;
-    S->PCMChip.vgm_log = 0;
-    vgm_poke32(0xdc,S->PCMClock | Audio->state.MuteRear<<31);
-    vgm_poke8(0xd6,288/4);
+    vgm_poke32(S->PCMChip.vgm,0xdc,S->PCMClock | g->MuteRear<<31);
+    vgm_poke8(S->PCMChip.vgm,0xd6,288/4);
 
-    vgm_poke32(0x30,S->FMClock);
+    vgm_poke32(S->PCMChip.vgm,0x30,S->FMClock);
+    S->PCMChip.vgm = NULL;
 }
 void S2X_IReset(void* d,QP_Game* g,int initial)
 {
@@ -85,8 +142,7 @@ void S2X_IReset(void* d,QP_Game* g,int initial)
     Q_DEBUG("S2X: Reset\n");
     YM2151_reset(&S->FMChip);
 
-    S->FMQueueRead=0;
-    S->FMQueueWrite=0;
+    S2X_OPMClearQueue(S);
 
     if(initial)
         S2X_Init(S);
@@ -243,48 +299,443 @@ double S2X_ITickRate(void* d)
 }
 void S2X_IUpdateTick(void* d)
 {
-    S2X_UpdateTick(d);
+    S2X_State* S = d;
+    // no samples since the last tick, the chips are not being rendered
+    if(S->FMTime == S->FMTickTime)
+    {
+        S2X_OPMFlushQueue(S);
+        S2X_ClearFMHistory(S);
+    }
+    S->FMTickTime = S->FMTime;
+    S2X_UpdateTick(S);
 }
 double S2X_IChipRate(void* d)
 {
     S2X_State* S = d;
     return S->SoundRate;
 }
-void S2X_IUpdateChip(void* d)
+// Mix one sample, the FM output is already at the PCM rate.
+static void S2X_MixFM(int32_t* pcm,const double* fm,float* samples,int samplecnt)
 {
-    S2X_State *S = d;
-    S->FMTicks += S->FMDelta;
-    S->FMWriteTicks += S->FMDelta;
-    while(S->FMWriteTicks > S->FMWriteRate)
+    int i;
+    if(samplecnt > 4)
+        samplecnt=4;
+    for(i=0;i<samplecnt;i++)
+        samples[i] = (double)pcm[i] / (1<<28);
+    if(samplecnt > 2)
+        samplecnt=2;
+    for(i=0;i<samplecnt;i++)
+    {
+        samples[i] += fm[i]/6;
+        //samples[i] += fm[i]/12; // for finallap
+    }
+}
+// Linear interpolation between FM samples. hist holds the last two FM
+// samples before the block.
+static void S2X_ResampleLinear(const double* hist,const int32_t* buffer,int count,const int* pos,const double* frac,double* out,int frames)
+{
+    double fm[(S2X_RENDER_BLOCK+3)*2];
+    const double *last, *next;
+    int i;
+
+    for(i=0;i<4;i++)
+        fm[i] = hist[i];
+    for(i=0;i<count*2;i++)
+        fm[i+4] = buffer[i]/32768.0;
+
+    for(i=0;i<frames;i++)
+    {
+        last = fm+pos[i]*2;
+        next = last+2;
+        out[i*2+0] = last[0]+(frac[i]*(next[0]-last[0]));
+        out[i*2+1] = last[1]+(frac[i]*(next[1]-last[1]));
+    }
+}
+// Polyphase FIR, the last samples of each block are kept in history for
+// the next one.
+static void S2X_ResampleFIR(fir_t* filter,float* history,const int32_t* buffer,int count,const int* pos,const double* frac,double* out,int frames)
+{
+    float x[(S2X_RENDER_BLOCK+1+FIR_MAX_TAPS)*2];
+    float y[2];
+    int i, taps = filter->Taps;
+
+    memcpy(x,history,taps*2*sizeof(float));
+    for(i=0;i<count*2;i++)
+        x[taps*2+i] = buffer[i]/32768.0f;
+    memcpy(history,x+count*2,taps*2*sizeof(float));
+
+    for(i=0;i<frames;i++)
+    {
+        fir_filter(filter,x+pos[i]*2,frac[i],y);
+        out[i*2+0] = y[0];
+        out[i*2+1] = y[1];
+    }
+}
+// Render FM samples to buffer. With stems, the chip is rendered a sample
+// at a time and the output of each channel is also written to stembuf.
+static void S2X_RenderFMSamples(S2X_State *S,int32_t* buffer,int32_t* stembuf,int count)
+{
+    int i, ch;
+
+    if(!stembuf)
+    {
+        YM2151_render(&S->FMChip,buffer,count);
+        return;
+    }
+    for(i=0;i<count;i++)
+    {
+        YM2151_render(&S->FMChip,buffer+i*2,1);
+        for(ch=0;ch<8;ch++)
+        {
+            stembuf[i*16+ch*2+0] = S->FMChip.stem_out[ch][0]*32768;
+            stembuf[i*16+ch*2+1] = S->FMChip.stem_out[ch][1]*32768;
+        }
+    }
+}
+// Convert FM samples to the PCM rate with the selected resampler.
+static void S2X_ResampleFM(S2X_State *S,const double* hist,float* history,const int32_t* buffer,int count,const int* pos,const double* frac,double* out,int frames)
+{
+    if(S->FMFilter)
+        S2X_ResampleFIR(S->FMFilter,history,buffer,count,pos,frac,out,frames);
+    else
+        S2X_ResampleLinear(hist,buffer,count,pos,frac,out,frames);
+}
+// Render the FM chip for a block of PCM samples and convert it to the PCM
+// rate, out receives the FM output of each sample (left, right). If stems
+// is not NULL (S->FMChip.stems must be set), it receives the output of
+// each FM channel in the same way, 8 channels per sample. The YM2151 is
+// rendered in blocks between register writes.
+static void S2X_RenderFM(S2X_State *S,double* out,double* stems,int frames)
+{
+    int32_t buffer[(S2X_RENDER_BLOCK+1)*2];
+    int32_t stembuf[(S2X_RENDER_BLOCK+1)*16];
+    int32_t chbuf[(S2X_RENDER_BLOCK+1)*2];
+    double chout[S2X_RENDER_BLOCK*2];
+    double frac[S2X_RENDER_BLOCK];
+    int pos[S2X_RENDER_BLOCK];
+    double hist[4], stemhist[8][4];
+    int32_t *sbuf = stems ? stembuf : NULL;
+    int i, ch, count = 0, pending = 0;
+
+    hist[0] = S->FMChip.out[2];
+    hist[1] = S->FMChip.out[3];
+    hist[2] = S->FMChip.out[0];
+    hist[3] = S->FMChip.out[1];
+    if(stems)
     {
-        if((S->FMQueueRead&0x1ff) != (S->FMQueueWrite&0x1ff))
-            S2X_OPMReadQueue(S);
-        S->FMWriteTicks-=S->FMWriteRate;
+        for(ch=0;ch<8;ch++)
+        {
+            stemhist[ch][0] = S->FMChip.stem_out[ch][2];
+            stemhist[ch][1] = S->FMChip.stem_out[ch][3];
+            stemhist[ch][2] = S->FMChip.stem_out[ch][0];
+            stemhist[ch][3] = S->FMChip.stem_out[ch][1];
+        }
     }
-    while(S->FMTicks > 1.0)
+    for(i=0;i<frames;i++)
     {
-        YM2151_update(&S->FMChip);
-        S->FMTicks-=1.0;
+        S->FMTime++;
+        if(S->FMQueueRead != S->FMQueueWrite && S->FMQueue[S->FMQueueRead].Time <= S->FMTime)
+        {
+            S2X_RenderFMSamples(S,buffer+count*2,sbuf ? sbuf+count*16 : NULL,pending);
+            count += pending;
+            pending = 0;
+            S2X_OPMUpdateQueue(S);
+        }
+        S->FMTicks += S->FMDelta;
+        while(S->FMTicks > 1.0)
+        {
+            pending++;
+            S->FMTicks-=1.0;
+        }
+        pos[i] = count+pending;
+        frac[i] = S->FMTicks;
     }
+    S2X_RenderFMSamples(S,buffer+count*2,sbuf ? sbuf+count*16 : NULL,pending);
+    count += pending;
 
+    S2X_ResampleFM(S,hist,S->FMHistory,buffer,count,pos,frac,out,frames);
+    if(!stems)
+        return;
+
+    for(ch=0;ch<8;ch++)
+    {
+        for(i=0;i<count;i++)
+        {
+            chbuf[i*2+0] = stembuf[i*16+ch*2+0];
+            chbuf[i*2+1] = stembuf[i*16+ch*2+1];
+        }
+        S2X_ResampleFM(S,stemhist[ch],S->FMStemHistory[ch],chbuf,count,pos,frac,chout,frames);
+        for(i=0;i<frames;i++)
+        {
+            stems[i*16+ch*2+0] = chout[i*2+0];
+            stems[i*16+ch*2+1] = chout[i*2+1];
+        }
+    }
+}
+void S2X_IUpdateChip(void* d)
+{
+    S2X_State *S = d;
+    S2X_RenderFM(S,S->FMOut,NULL,1);
     C352_update(&S->PCMChip);
 }
 void S2X_ISampleChip(void* d,float* samples,int samplecnt)
 {
     S2X_State* S = d;
-    int i;
-    if(samplecnt > 4)
-        samplecnt=4;
-    for(i=0;i<samplecnt;i++)
-        samples[i] = S->PCMChip.out[i] / (1<<28);
-    if(samplecnt > 2)
-        samplecnt=2;
-    for(i=0;i<samplecnt;i++)
+    S2X_MixFM(S->PCMChip.out,S->FMOut,samples,samplecnt);
+}
+// The FM chip can be rendered on its own thread while the driver thread
+// renders the C352. The C352 stays on the driver thread since the driver
+// reads back its voice flags, the YM2151 only receives writes, which are
+// already in the timeline when IRenderBlock is called.
+struct S2X_FMThread {
+    qp_thread_t Thread;
+    qp_mutex_t Lock;
+    qp_cond_t Start;
+    qp_cond_t Done;
+    S2X_State* S;
+    int Frames; // frames to render, 0 when idle, -1 to quit
+
+    // S2X_RenderFM and C352 output
+    int Size;
+    double* FM;
+    int32_t* PCM;
+};
+
+#define S2X_FM_SPIN 20000 // polls before sleeping, the next block usually follows soon
+
+// Wait until the FM thread is busy (a block was started) or idle. Returns
+// the frame count.
+static int S2X_FMThreadWait(struct S2X_FMThread* T,qp_cond_t* cond,int busy)
+{
+    int i, frames;
+
+    for(i=0;i<S2X_FM_SPIN;i++)
     {
-        double last = S->FMChip.out[i+2];
-        double next = S->FMChip.out[i];
-        samples[i] += (last+(S->FMTicks*(next-last)))/6;
-        //samples[i] += (last+(S->FMTicks*(next-last)))/12; // for finallap
+        frames = __atomic_load_n(&T->Frames,__ATOMIC_ACQUIRE);
+        if((frames != 0) == busy)
+            return frames;
+    }
+
+    mutex_lock(&T->Lock);
+    while((T->Frames != 0) != busy)
+        cond_wait(cond,&T->Lock);
+    frames = T->Frames;
+    mutex_unlock(&T->Lock);
+    return frames;
+}
+
+static void S2X_FMThreadSet(struct S2X_FMThread* T,qp_cond_t* cond,int frames)
+{
+    mutex_lock(&T->Lock);
+    __atomic_store_n(&T->Frames,frames,__ATOMIC_RELEASE);
+    cond_signal(cond);
+    mutex_unlock(&T->Lock);
+}
+
+static int S2X_FMWorker(void* data)
+{
+    struct S2X_FMThread* T = data;
+    int i, frames, count;
+
+    while((frames = S2X_FMThreadWait(T,&T->Start,1)) > 0)
+    {
+        for(i=0;i<frames;i+=count)
+        {
+            count = frames-i < S2X_RENDER_BLOCK ? frames-i : S2X_RENDER_BLOCK;
+            S2X_RenderFM(T->S,T->FM+i*2,NULL,count);
+        }
+        S2X_FMThreadSet(T,&T->Done,0);
+    }
+    return 0;
+}
+
+// make room for this many frames
+static int S2X_FMThreadAlloc(struct S2X_FMThread* T,int frames)
+{
+    void *fm, *pcm;
+
+    if(frames <= T->Size)
+        return 0;
+
+    fm = realloc(T->FM,frames*2*sizeof(double));
+    if(fm)
+        T->FM = fm;
+    pcm = realloc(T->PCM,frames*4*sizeof(int32_t));
+    if(pcm)
+        T->PCM = pcm;
+
+    if(!fm || !pcm)
+        return -1;
+    T->Size = frames;
+    return 0;
+}
+
+static void S2X_FMThreadStop(S2X_State *S)
+{
+    struct S2X_FMThread* T = S->FMThread;
+    if(!T)
+        return;
+
+    S2X_FMThreadSet(T,&T->Start,-1);
+    thread_join(&T->Thread);
+
+    cond_destroy(&T->Start);
+    cond_destroy(&T->Done);
+    mutex_destroy(&T->Lock);
+    free(T->FM);
+    free(T->PCM);
+    free(T);
+    S->FMThread = NULL;
+}
+
+static int S2X_FMThreadStart(S2X_State *S)
+{
+    struct S2X_FMThread* T;
+    if(S->FMThread)
+        return 0;
+
+    T = (struct S2X_FMThread*)calloc(1,sizeof(struct S2X_FMThread));
+    if(!T)
+        return -1;
+    T->S = S;
+    mutex_init(&T->Lock);
+    cond_init(&T->Start);
+    cond_init(&T->Done);
+    if(S2X_FMThreadAlloc(T,S2X_RENDER_BLOCK*4) || thread_create(&T->Thread,S2X_FMWorker,T))
+    {
+        cond_destroy(&T->Start);
+        cond_destroy(&T->Done);
+        mutex_destroy(&T->Lock);
+        free(T->FM);
+        free(T->PCM);
+        free(T);
+        return -1;
+    }
+    S->FMThread = T;
+    return 0;
+}
+
+// Enable or disable the FM render thread. Only for offline rendering, the
+// output is the same either way.
+int S2X_ISetChipThreads(void* d,int enable)
+{
+    S2X_State *S = d;
+    if(!enable)
+    {
+        S2X_FMThreadStop(S);
+        return 0;
+    }
+    if(S2X_FMThreadStart(S))
+    {
+        Q_DEBUG("could not start the FM render thread\n");
+        return 0;
+    }
+    return 1;
+}
+
+// The FM thread renders the YM2151 for the whole call while this thread
+// renders the C352, then both are mixed.
+static int S2X_RenderBlockThreaded(S2X_State *S,float* out,int frames,int channels)
+{
+    struct S2X_FMThread* T = S->FMThread;
+    int i, count;
+
+    if(S2X_FMThreadAlloc(T,frames))
+        return -1;
+
+    S2X_FMThreadSet(T,&T->Start,frames);
+
+    for(i=0;i<frames;i+=count)
+    {
+        count = frames-i < S2X_RENDER_BLOCK ? frames-i : S2X_RENDER_BLOCK;
+        C352_render(&S->PCMChip,T->PCM+i*4,count);
+    }
+
+    S2X_FMThreadWait(T,&T->Done,0);
+
+    for(i=0;i<frames;i++)
+    {
+        S2X_MixFM(T->PCM+i*4,T->FM+i*2,out,channels);
+        out += channels;
+    }
+    return 0;
+}
+
+// The C352 and YM2151 are rendered a block at a time and mixed.
+void S2X_IRenderBlock(void* d,float* out,int frames,int channels)
+{
+    S2X_State *S = d;
+    int32_t buffer[S2X_RENDER_BLOCK*4];
+    double fm[S2X_RENDER_BLOCK*2];
+    int i, count;
+
+    if(S->FMThread && !S2X_RenderBlockThreaded(S,out,frames,channels))
+        return;
+
+    while(frames > 0)
+    {
+        count = frames < S2X_RENDER_BLOCK ? frames : S2X_RENDER_BLOCK;
+        C352_render(&S->PCMChip,buffer,count);
+        S2X_RenderFM(S,fm,NULL,count);
+        for(i=0;i<count;i++)
+        {
+            S2X_MixFM(buffer+i*4,fm+i*2,out,channels);
+            out += channels;
+        }
+        frames -= count;
+    }
+}
+
+// one stem per C352 voice followed by the FM channels
+int S2X_IGetStemCount(void* d)
+{
+    return S2X_STEM_COUNT;
+}
+void S2X_IGetStemName(void* d,int stem,char* buffer,int len)
+{
+    if(stem < C352_VOICES)
+        snprintf(buffer,len,"pcm%02d",stem);
+    else
+        snprintf(buffer,len,"fm%d",stem-C352_VOICES);
+}
+void S2X_IRenderStems(void* d,float* out,float** stems,int frames,int channels)
+{
+    S2X_State *S = d;
+    int32_t buffer[S2X_STEM_BLOCK*4];
+    int32_t stembuf[C352_VOICES][S2X_STEM_BLOCK*4];
+    int32_t *stem[C352_VOICES];
+    double fm[S2X_STEM_BLOCK*2];
+    double fmstems[S2X_STEM_BLOCK*16];
+    int i, j, v, count, pos = 0;
+    float *o;
+
+    if(channels > 4)
+        channels=4;
+    for(v=0;v<C352_VOICES;v++)
+        stem[v] = stembuf[v];
+
+    S->FMChip.stems = 1;
+    while(pos < frames)
+    {
+        count = frames-pos < S2X_STEM_BLOCK ? frames-pos : S2X_STEM_BLOCK;
+        C352_render_stems(&S->PCMChip,buffer,stem,count);
+        S2X_RenderFM(S,fm,fmstems,count);
+        for(i=0;i<count;i++,pos++)
+        {
+            S2X_MixFM(buffer+i*4,fm+i*2,out+pos*channels,channels);
+
+            for(v=0;v<C352_VOICES;v++)
+            {
+                for(j=0;j<channels;j++)
+                    stems[v][pos*channels+j] = (double)stem[v][i*4+j] / (1<<28);
+            }
+            for(v=0;v<8;v++)
+            {
+                o = stems[C352_VOICES+v]+pos*channels;
+                for(j=0;j<channels;j++)
+                    o[j] = j < 2 ? fmstems[i*16+v*2+j]/6 : 0;
+            }
+        }
     }
 }
 
@@ -514,6 +965,14 @@ uint16_t S2X_IGetVoiceStatus(void* d,int id)
     }
     return v;
 }
+uint32_t S2X_IStateSave(void* d,uint8_t* buffer,uint32_t size)
+{
+    return S2X_StateSave(d,buffer,size);
+}
+int S2X_IStateLoad(void* d,uint8_t* buffer,uint32_t size)
+{
+    return S2X_StateLoad(d,buffer,size);
+}
 struct QP_DriverInterface S2X_CreateInterface()
 {
     struct QP_DriverInterface d = {
@@ -556,6 +1015,12 @@ struct QP_DriverInterface S2X_CreateInterface()
         .IChipRate = &S2X_IChipRate,
         .IUpdateChip = &S2X_IUpdateChip,
         .ISampleChip = &S2X_ISampleChip,
+        .IRenderBlock = &S2X_IRenderBlock,
+
+        .IGetStemCount = &S2X_IGetStemCount,
+        .IGetStemName = &S2X_IGetStemName,
+        .IRenderStems = &S2X_IRenderStems,
+        .ISetChipThreads = &S2X_ISetChipThreads,
 
         .IGetMute = &S2X_IGetMute,
         .ISetMute = &S2X_ISetMute,
@@ -566,6 +1031,9 @@ struct QP_DriverInterface S2X_CreateInterface()
         .IGetVoiceCount = &S2X_IGetVoiceCount,
         .IGetVoiceInfo = &S2X_IGetVoiceInfo,
         .IGetVoiceStatus = &S2X_IGetVoiceStatus,
+
+        .IStateSave = &S2X_IStateSave,
+        .IStateLoad = &S2X_IStateLoad,
     };
     return d;
 }
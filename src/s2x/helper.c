@@ -3,6 +3,7 @@
 
 #include "../qp.h"
 #include "../lib/vgm.h"
+#include "../lib/state.h"
 
 #include "s2x.h"
 #include "helper.h"
@@ -39,6 +40,33 @@ void S2X_UpdateMuteMask(S2X_State *S)
     }
 }
 
+// Find the sample where the next register write is done. One register is
+// written every FMWriteRate FM samples, the write slots are counted with
+// the same clock used to poll the queue on every PCM sample, so the timing
+// is unchanged. Slots in samples that are already rendered are skipped.
+static uint64_t S2X_OPMWriteSlot(S2X_State *S)
+{
+    if(S->FMWriteTime <= S->FMTime)
+    {
+        while(S->FMWriteTicks > S->FMWriteRate)
+            S->FMWriteTicks -= S->FMWriteRate;
+        while(S->FMWriteTime < S->FMTime)
+        {
+            S->FMWriteTime++;
+            S->FMWriteTicks += S->FMDelta;
+            while(S->FMWriteTicks > S->FMWriteRate)
+                S->FMWriteTicks -= S->FMWriteRate;
+        }
+    }
+    while(!(S->FMWriteTicks > S->FMWriteRate))
+    {
+        S->FMWriteTime++;
+        S->FMWriteTicks += S->FMDelta;
+    }
+    S->FMWriteTicks -= S->FMWriteRate;
+    return S->FMWriteTime;
+}
+
 void S2X_OPMWrite(S2X_State *S,int ch,int op,int reg,uint8_t data)
 {
     ch&=7;
@@ -50,28 +78,90 @@ void S2X_OPMWrite(S2X_State *S,int ch,int op,int reg,uint8_t data)
     else if(reg == 0x08)
         data |= ch;
 
-    if(S->PCMChip.vgm_log)
-        vgm_write(0x54,0,fmreg,data);
+    if(S->PCMChip.vgm)
+        vgm_write(S->PCMChip.vgm,0x54,0,fmreg,data);
+
+    S2X_FMWrite* w;
+    uint32_t size;
+
+    // grow the queue, or move the pending writes to the start
+    if(S->FMQueueWrite == S->FMQueueSize)
+    {
+        if(S->FMQueueRead)
+        {
+            memmove(S->FMQueue,S->FMQueue+S->FMQueueRead,(S->FMQueueWrite-S->FMQueueRead)*sizeof(S2X_FMWrite));
+            S->FMQueueWrite -= S->FMQueueRead;
+            S->FMQueueRead = 0;
+        }
+        else
+        {
+            size = S->FMQueueSize ? S->FMQueueSize*2 : 256;
+            w = (S2X_FMWrite*)realloc(S->FMQueue,size*sizeof(S2X_FMWrite));
+            if(!w)
+            {
+                Q_DEBUG("FM write queue is full\n");
+                YM2151_write_reg(&S->FMChip,fmreg,data);
+                return;
+            }
+            S->FMQueue = w;
+            S->FMQueueSize = size;
+        }
+    }
 
-    S2X_FMWrite w = {fmreg,data};
+    w = &S->FMQueue[S->FMQueueWrite++];
+    w->Time = S2X_OPMWriteSlot(S);
+    w->Reg = fmreg;
+    w->Data = data;
+}
 
-    //Q_DEBUG("write queue %02x (%02x %02x)\n",S->FMQueueWrite,fmreg,data);
-    S->FMQueue[(S->FMQueueWrite++)&0x1ff] = w;
+// Do the register writes scheduled for the current sample (S->FMTime).
+void S2X_OPMUpdateQueue(S2X_State *S)
+{
+    S2X_FMWrite* w;
+    while(S->FMQueueRead != S->FMQueueWrite)
+    {
+        w = &S->FMQueue[S->FMQueueRead];
+        if(w->Time > S->FMTime)
+            return;
+        YM2151_write_reg(&S->FMChip,w->Reg,w->Data);
+        S->FMQueueRead++;
+    }
+    S->FMQueueRead = S->FMQueueWrite = 0;
+}
 
-    // flush the queue!
-    if((S->FMQueueWrite&0x1ff) == (S->FMQueueRead&0x1ff))
+// Do all pending register writes now. Used when the driver is updated
+// without rendering (when seeking), so the writes don't pile up.
+void S2X_OPMFlushQueue(S2X_State *S)
+{
+    S2X_FMWrite* w;
+    while(S->FMQueueRead != S->FMQueueWrite)
     {
-        Q_DEBUG("flushing queue (OPM is not keeping up!)\n");
-        do S2X_OPMReadQueue(S);
-        while ((S->FMQueueWrite&0x1ff) != (S->FMQueueRead&0x1ff));
+        w = &S->FMQueue[S->FMQueueRead++];
+        YM2151_write_reg(&S->FMChip,w->Reg,w->Data);
     }
+    S->FMQueueRead = S->FMQueueWrite = 0;
+    if(S->FMWriteTime > S->FMTime)
+        S->FMWriteTime = S->FMTime;
+}
+
+// Clear the FM resampler history, the chip output is not continuous after
+// seeking or loading a state.
+void S2X_ClearFMHistory(S2X_State *S)
+{
+    memset(S->FMHistory,0,sizeof(S->FMHistory));
+    memset(S->FMStemHistory,0,sizeof(S->FMStemHistory));
+}
+
+void S2X_OPMClearQueue(S2X_State *S)
+{
+    S->FMQueueRead = S->FMQueueWrite = 0;
 }
 
-void S2X_OPMReadQueue(S2X_State *S)
+void S2X_OPMFreeQueue(S2X_State *S)
 {
-    //Q_DEBUG("read  queue %02x (%02x %02x)\n",S->FMQueueRead,S->FMQueue[S->FMQueueRead].Reg,S->FMQueue[S->FMQueueRead].Data);
-    S2X_FMWrite* w = &S->FMQueue[(S->FMQueueRead++)&0x1ff];
-    return YM2151_write_reg(&S->FMChip,w->Reg,w->Data);
+    free(S->FMQueue);
+    S->FMQueue = NULL;
+    S->FMQueueSize = S->FMQueueRead = S->FMQueueWrite = 0;
 }
 
 // only used when writes need to be synchronized for link mode
@@ -290,3 +380,154 @@ uint8_t S2X_ConvertFMKeycode(uint8_t d)
         return 0xff;
     return ((d>>2)*3)+(d&3);
 }
+
+// relocate the internal pointers of a state copy, see lib/state.h
+static void S2X_StateRelocate(S2X_State *S, S2X_State *D, int load)
+{
+    int i, j;
+#define RELOC(_p) (_p) = load ? state_ptr_load(S,sizeof(*S),_p) : state_ptr_save(S,sizeof(*S),_p)
+    for(i=0;i<32;i++)
+    {
+        RELOC(D->FMChip.oper[i].connect);
+        RELOC(D->FMChip.oper[i].mem_connect);
+    }
+    for(i=0;i<S2X_MAX_TRACKS;i++)
+    {
+        for(j=0;j<S2X_MAX_TRKCHN;j++)
+            RELOC(D->Track[i].Channel[j].Track);
+    }
+    for(i=0;i<S2X_MAX_VOICES;i++)
+        RELOC(D->ActiveChannel[i]);
+    for(i=0;i<S2X_MAX_VOICES_PCM;i++)
+    {
+        RELOC(D->PCM[i].Pitch.FM);
+        RELOC(D->PCM[i].Track);
+        RELOC(D->PCM[i].Channel);
+    }
+    for(i=0;i<S2X_MAX_VOICES_FM;i++)
+    {
+        RELOC(D->FM[i].Pitch.FM);
+        RELOC(D->FM[i].Track);
+        RELOC(D->FM[i].Channel);
+    }
+    for(i=0;i<S2X_MAX_VOICES_WSG;i++)
+    {
+        RELOC(D->WSG[i].Track);
+        RELOC(D->WSG[i].Channel);
+    }
+#undef RELOC
+}
+
+// copy the parts that are not saved (game data, configuration and loggers)
+static void S2X_StateKeep(S2X_State *S, S2X_State *D)
+{
+    D->Data = S->Data;
+    memcpy(D->BankName,S->BankName,sizeof(S->BankName));
+    D->PCMChip.wave = S->PCMChip.wave;
+    D->PCMChip.cache = S->PCMChip.cache;
+    D->PCMChip.vgm = S->PCMChip.vgm;
+    D->PCMChip.mix = S->PCMChip.mix;
+    D->FMChip.calc = S->FMChip.calc;
+    D->FMQueue = S->FMQueue;
+    D->FMQueueSize = S->FMQueueSize;
+    D->FMFilter = S->FMFilter;
+    D->FMThread = S->FMThread;
+    D->LoopDetect = S->LoopDetect;
+}
+
+// Save the driver and sound chip state. Returns the size of the state,
+// nothing is written if the buffer is too small.
+uint32_t S2X_StateSave(S2X_State *S, uint8_t* buffer, uint32_t size)
+{
+    state_t s;
+    uint32_t structsize = sizeof(S2X_State);
+    S2X_State *D = (S2X_State*)malloc(sizeof(S2X_State));
+    if(!D)
+        return 0;
+
+    memcpy(D,S,sizeof(S2X_State));
+    S2X_StateRelocate(S,D,0);
+    D->Data = NULL;
+    memset(D->BankName,0,sizeof(D->BankName));
+    D->PCMChip.wave = NULL;
+    D->PCMChip.cache = NULL;
+    D->PCMChip.mix = NULL;
+    D->FMChip.calc = NULL;
+    D->PCMChip.vgm = NULL;
+    D->FMFilter = NULL;
+    D->FMThread = NULL;
+    memset(&D->LoopDetect,0,sizeof(D->LoopDetect));
+
+    // pending FM writes are stored after the struct
+    D->FMQueue = NULL;
+    D->FMQueueSize = 0;
+    D->FMQueueRead = 0;
+    D->FMQueueWrite = S->FMQueueWrite-S->FMQueueRead;
+
+    state_init(&s,buffer,size);
+    state_write(&s,&structsize,sizeof(structsize));
+    state_write(&s,D,sizeof(S2X_State));
+    state_write(&s,S->FMQueue+S->FMQueueRead,D->FMQueueWrite*sizeof(S2X_FMWrite));
+    QP_LoopDetectStateSave(&S->LoopDetect,&s);
+    free(D);
+    return s.pos;
+}
+
+// Load a state saved by S2X_StateSave. The mute and solo masks are kept.
+// Returns -1 if the state is invalid.
+int S2X_StateLoad(S2X_State *S, uint8_t* buffer, uint32_t size)
+{
+    state_t s;
+    uint32_t structsize = 0, count;
+    S2X_FMWrite *queue = NULL;
+    S2X_State *D = (S2X_State*)malloc(sizeof(S2X_State));
+    if(!D)
+        return -1;
+
+    state_init(&s,buffer,size);
+    state_read(&s,&structsize,sizeof(structsize));
+    if(structsize == sizeof(S2X_State))
+        state_read(&s,D,sizeof(S2X_State));
+    if(s.error || structsize != sizeof(S2X_State))
+    {
+        free(D);
+        return -1;
+    }
+
+    // pending FM writes
+    count = D->FMQueueWrite;
+    if(count > (s.size-s.pos)/sizeof(S2X_FMWrite))
+        s.error = 1;
+    else if(count)
+    {
+        queue = (S2X_FMWrite*)malloc(count*sizeof(S2X_FMWrite));
+        if(!queue)
+            s.error = 1;
+        state_read(&s,queue,count*sizeof(S2X_FMWrite));
+    }
+
+    S2X_StateRelocate(S,D,1);
+    S2X_StateKeep(S,D);
+    D->MuteMask = S->MuteMask;
+    D->SoloMask = S->SoloMask;
+    QP_LoopDetectStateLoad(&D->LoopDetect,&s);
+
+    if(!s.error)
+    {
+        memcpy(S,D,sizeof(S2X_State));
+        if(queue)
+        {
+            free(S->FMQueue);
+            S->FMQueue = queue;
+            S->FMQueueSize = count;
+            queue = NULL;
+        }
+        S->FMQueueRead = 0;
+        S->FMQueueWrite = count;
+        S2X_ClearFMHistory(S);
+    }
+    free(queue);
+    free(D);
+    S2X_UpdateMuteMask(S);
+    return s.error ? -1 : 0;
+}
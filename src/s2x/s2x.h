@@ -8,6 +8,7 @@
 
 #include "../emu/c352.h"
 #include "../emu/ym2151.h"
+#include "../lib/fir.h"
 #include "../lib/loopdetect.h"
 
 #include "enum.h"
@@ -22,6 +23,10 @@ void S2X_Deinit(S2X_State *S);
 void S2X_Reset(S2X_State *S);
 void S2X_UpdateTick(S2X_State *S);
 
+// Save/load driver state
+uint32_t S2X_StateSave(S2X_State *S, uint8_t* buffer, uint32_t size);
+int S2X_StateLoad(S2X_State *S, uint8_t* buffer, uint32_t size);
+
 struct QP_DriverInterface S2X_CreateInterface();
 
 #endif // S2X_H_INCLUDED
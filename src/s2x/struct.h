@@ -252,6 +252,7 @@ struct S2X_SE {
 };
 
 struct S2X_FMWrite {
+    uint64_t Time; // S2X_State.FMTime when the register is written
     uint8_t Reg;
     uint8_t Data;
 };
@@ -262,8 +263,11 @@ struct S2X_State {
     double SoundRate;
     double FMDelta;
     double FMTicks;
-    double FMWriteTicks;
-    double FMWriteRate;
+    double FMWriteTicks;    // write slot clock at FMWriteTime
+    double FMWriteRate;     // FM samples between register writes
+    uint64_t FMTime;        // PCM samples rendered
+    uint64_t FMWriteTime;   // sample of the last assigned write slot
+    uint64_t FMTickTime;    // FMTime at the last driver tick
 
     uint32_t SoloMask;
     uint32_t MuteMask;
@@ -276,6 +280,7 @@ struct S2X_State {
 
     // ROM data
     uint8_t *Data;
+    uint32_t DataSize;
 
     // misc
     char *BankName[S2X_MAX_BANK];
@@ -308,9 +313,21 @@ struct S2X_State {
     uint8_t FMLfoAms;
     uint16_t FMLfoDepthDelta;
 
-    uint16_t FMQueueWrite;
-    uint16_t FMQueueRead;
-    S2X_FMWrite FMQueue[512];
+    // FM register writes in time order, see S2X_OPMWrite
+    S2X_FMWrite *FMQueue;
+    uint32_t FMQueueSize;
+    uint32_t FMQueueWrite;
+    uint32_t FMQueueRead;
+
+    // FM resampling filter (NULL = linear interpolation) and the last
+    // FM samples of the output and each channel, see S2X_RenderFM
+    fir_t *FMFilter;
+    float FMHistory[FIR_MAX_TAPS*2];
+    float FMStemHistory[8][FIR_MAX_TAPS*2];
+    double FMOut[2]; // FM output of the last S2X_IUpdateChip call
+
+    // FM render thread, see S2X_ISetChipThreads
+    struct S2X_FMThread *FMThread;
 
     // track vars
     uint16_t SongRequest[S2X_MAX_TRACKS+1];
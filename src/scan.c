@@ -0,0 +1,145 @@
+/*
+    Song length scan
+
+    Runs only the sound driver (no chip emulation) to find the loop points
+    and end of a song. The song is tracked with the driver's loop detection:
+    the loop count increases each time the song passes its loop start, so
+    the first two increments give the loop start and loop length.
+*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "qp.h"
+#include "scan.h"
+
+#define SCAN_BLOCK_SIZE 65536
+
+typedef struct {
+    QP_ScanResult *res;
+    int slot;
+    int started;
+    int stopped;
+    int loops;
+    uint32_t samples; // samples scanned before the current block
+    uint32_t time_limit;
+    uint32_t loop_tick[2];
+    uint32_t loop_sample[2];
+} QP_ScanState;
+
+static void scan_voices(QP_Context* ctx, QP_ScanResult* res)
+{
+    struct QP_DriverVoiceInfo vi;
+    int i, count = 0;
+
+    for(i=0;i<DriverGetVoiceCount(ctx);i++)
+    {
+        if(DriverGetVoiceInfo(ctx,i,&vi) || ~vi.Status & VOICE_STATUS_PLAYING)
+            continue;
+        count++;
+        if(vi.VoiceType & VOICE_TYPE_PCM)
+            res->Waves[(vi.Preset/32)%(QP_SCAN_MAX_WAVES/32)] |= 1U<<(vi.Preset&31);
+    }
+    if(count > res->MaxVoices)
+        res->MaxVoices = count;
+}
+
+static int scan_tick(QP_Context* ctx, void* data, int offset)
+{
+    QP_ScanState *s = data;
+    uint32_t pos = s->samples+offset;
+    int status = DriverGetSongStatus(ctx,s->slot);
+    int loops = DriverGetLoopCount(ctx,s->slot);
+
+    if(status & SONG_STATUS_PLAYING)
+        s->started = 1;
+
+    scan_voices(ctx,s->res);
+
+    if(loops > s->loops)
+    {
+        s->loop_tick[s->loops] = ctx->TickCount;
+        s->loop_sample[s->loops] = pos;
+        if(++s->loops == 2)
+        {
+            s->res->Status = QP_SCAN_LOOPED;
+            s->stopped = 1;
+        }
+    }
+    else if(s->started && !(status&(SONG_STATUS_PLAYING|SONG_STATUS_STOPPING)))
+    {
+        s->res->Status = QP_SCAN_ENDED;
+        s->res->EndTicks = ctx->TickCount;
+        s->res->EndSamples = pos;
+        s->stopped = 1;
+    }
+    else if(s->time_limit && pos >= s->time_limit)
+        s->stopped = 1;
+
+    return s->stopped;
+}
+
+// Scan the song in G->AutoPlay, after doing a game action (playlist bank,
+// -1 = none). The game must be loaded but the driver not initialized.
+// Returns -1 if the driver could not be initialized.
+int QP_Scan(QP_Context* ctx, int Action, double TimeLimit, QP_ScanResult* res)
+{
+    QP_Game *G = ctx->Game;
+    QP_ScanState s;
+    int vgmlog = G->VgmLog;
+    struct QP_Keyframes *keyframes = ctx->Keyframes;
+
+    memset(res,0,sizeof(*res));
+    memset(&s,0,sizeof(s));
+    s.res = res;
+    s.slot = G->AutoPlay & 0x800 ? 8 : 0;
+
+    // the driver is reinitialized after scanning, keyframes would be useless
+    ctx->Keyframes = NULL;
+
+    G->VgmLog = 0;
+    if(InitGameDriver(ctx))
+    {
+        ctx->Keyframes = keyframes;
+        G->VgmLog = vgmlog;
+        printf("%s\n",G->ErrorMessage);
+        return -1;
+    }
+    G->VgmLog = vgmlog;
+
+    if(Action >= 0)
+        GameDoAction(ctx,Action);
+
+    res->TickRate = DriverGetTickRate(ctx);
+    res->ChipRate = DriverGetChipRate(ctx);
+    s.time_limit = TimeLimit*res->ChipRate;
+
+    ctx->TickFunc = scan_tick;
+    ctx->TickData = &s;
+
+    while(!s.stopped)
+        s.samples += DriverRender(ctx,NULL,SCAN_BLOCK_SIZE,0);
+
+    ctx->TickFunc = NULL;
+    ctx->TickData = NULL;
+
+    if(res->Status == QP_SCAN_LOOPED)
+    {
+        res->LoopTicks = s.loop_tick[1]-s.loop_tick[0];
+        res->LoopSamples = s.loop_sample[1]-s.loop_sample[0];
+        if(s.loop_tick[0] > res->LoopTicks)
+        {
+            res->IntroTicks = s.loop_tick[0]-res->LoopTicks;
+            res->IntroSamples = s.loop_sample[0]-res->LoopSamples;
+        }
+    }
+    else if(res->Status == QP_SCAN_ENDED)
+    {
+        res->IntroTicks = res->EndTicks;
+        res->IntroSamples = res->EndSamples;
+    }
+
+    DeInitGameDriver(ctx);
+    ctx->Keyframes = keyframes;
+    return 0;
+}
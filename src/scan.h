@@ -0,0 +1,44 @@
+#ifndef SCAN_H_INCLUDED
+#define SCAN_H_INCLUDED
+
+#include <stdint.h>
+
+#include "loader.h"
+
+enum QP_ScanStatus {
+    QP_SCAN_TIMEOUT = 0, // time limit reached before the song ended or looped
+    QP_SCAN_ENDED,       // song stopped by itself
+    QP_SCAN_LOOPED,      // song loops forever
+};
+
+// wave numbers tracked by the scan
+#define QP_SCAN_MAX_WAVES 0x2000
+
+// Song length from a driver-only scan. Sample positions are at the chip rate
+// and match the positions of the same ticks in DriverRender.
+typedef struct {
+
+    enum QP_ScanStatus Status;
+
+    double TickRate;
+    double ChipRate;
+
+    // length of the part before the loop (or the whole song if it ends)
+    uint32_t IntroTicks;
+    uint32_t IntroSamples;
+    // loop length, 0 if the song does not loop
+    uint32_t LoopTicks;
+    uint32_t LoopSamples;
+    // song end, 0 if the song does not end
+    uint32_t EndTicks;
+    uint32_t EndSamples;
+
+    // voice usage (from the driver state, not the sound chip)
+    int MaxVoices;
+    uint32_t Waves[QP_SCAN_MAX_WAVES/32]; // bitmask of PCM wave numbers used
+
+} QP_ScanResult;
+
+int QP_Scan(QP_Context* ctx, int Action, double TimeLimit, QP_ScanResult* res);
+
+#endif // SCAN_H_INCLUDED
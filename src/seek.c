@@ -0,0 +1,123 @@
+/*
+    Seeking using keyframes
+
+    While playing, DriverRender saves the driver state every few seconds.
+    Seeking restores the nearest keyframe before the target and then runs
+    only the sound driver (not the sound chips) up to the target, which is
+    a lot faster than rendering. Keyframes after a command has been run are
+    discarded, since the song may take a different path from there.
+*/
+#include <stdlib.h>
+#include <string.h>
+
+#include "qp.h"
+#include "seek.h"
+
+// Enable keyframe recording. Returns -1 on failure.
+int QP_SeekEnable(QP_Context* ctx, double Interval)
+{
+    QP_SeekDisable(ctx);
+    ctx->Keyframes = (QP_Keyframes*)calloc(1,sizeof(QP_Keyframes));
+    if(!ctx->Keyframes)
+        return -1;
+    ctx->Keyframes->Interval = Interval;
+    return 0;
+}
+
+void QP_SeekDisable(QP_Context* ctx)
+{
+    if(!ctx->Keyframes)
+        return;
+    QP_SeekClear(ctx,0);
+    free(ctx->Keyframes);
+    ctx->Keyframes = NULL;
+}
+
+// Discard keyframes recorded after Tick.
+void QP_SeekClear(QP_Context* ctx, uint32_t Tick)
+{
+    QP_Keyframes* k = ctx->Keyframes;
+    if(!k)
+        return;
+    while(k->Count && k->Frame[k->Count-1].Tick > Tick)
+        free(k->Frame[--k->Count].Data);
+}
+
+// drop every other keyframe when the list is full
+static void seek_thin(QP_Keyframes* k)
+{
+    int i;
+    for(i=0;i<k->Count;i++)
+    {
+        if(i&1)
+            free(k->Frame[i].Data);
+        else
+            k->Frame[i/2] = k->Frame[i];
+    }
+    k->Count = (k->Count+1)/2;
+    k->Interval *= 2;
+}
+
+// Save a keyframe if enough time has passed since the last one. Called by
+// DriverRender after each tick.
+void QP_SeekRecord(QP_Context* ctx)
+{
+    QP_Keyframes* k = ctx->Keyframes;
+    QP_Keyframe* f;
+
+    if(!k)
+        return;
+    if(k->Count && ctx->TickCount < k->Frame[k->Count-1].Tick + k->Interval*DriverGetTickRate(ctx))
+        return;
+    if(k->Count == QP_SEEK_MAX_KEYFRAMES)
+        seek_thin(k);
+
+    f = &k->Frame[k->Count];
+    f->Tick = ctx->TickCount;
+    f->Size = DriverStateSave(ctx,NULL,0);
+    f->Data = (uint8_t*)malloc(f->Size);
+    if(!f->Size || !f->Data || DriverStateSave(ctx,f->Data,f->Size) != f->Size)
+    {
+        free(f->Data);
+        return;
+    }
+    k->Count++;
+}
+
+// Seek to a position in driver ticks (see ctx->TickCount). Voices that were
+// already playing at the restored keyframe keep their sample positions, so
+// these may be off by up to the keyframe interval.
+// Must be called from the thread that updates the driver, other threads
+// should use DriverPushCommand(ctx,QP_CMD_SEEK,Tick,0).
+// Returns -1 if seeking backwards past the first keyframe.
+int QP_Seek(QP_Context* ctx, uint32_t Tick)
+{
+    QP_Keyframes* k = ctx->Keyframes;
+    int i = -1;
+
+    if(k)
+    {
+        for(i=k->Count-1;i>=0;i--)
+            if(k->Frame[i].Tick <= Tick)
+                break;
+    }
+
+    // going backwards or the keyframe is ahead of the current position
+    if(i >= 0 && (Tick < ctx->TickCount || k->Frame[i].Tick > ctx->TickCount))
+    {
+        if(DriverStateLoad(ctx,k->Frame[i].Data,k->Frame[i].Size))
+            return -1;
+    }
+
+    if(Tick < ctx->TickCount)
+        return -1;
+
+    while(ctx->TickCount < Tick)
+    {
+        DriverUpdateTick(ctx);
+        __atomic_store_n(&ctx->TickCount,ctx->TickCount+1,__ATOMIC_RELAXED);
+        GameDoUpdate(ctx);
+        QP_SeekRecord(ctx);
+    }
+    return 0;
+}
@@ -0,0 +1,33 @@
+/*
+    Seeking using keyframes
+*/
+#ifndef SEEK_H_INCLUDED
+#define SEEK_H_INCLUDED
+
+#include <stdint.h>
+
+#include "context.h"
+
+#define QP_SEEK_INTERVAL 2.0 // default seconds between keyframes
+#define QP_SEEK_MAX_KEYFRAMES 256
+
+typedef struct {
+    uint32_t Tick; // ctx->TickCount when the state was saved
+    uint32_t Size;
+    uint8_t *Data; // DriverStateSave blob
+} QP_Keyframe;
+
+// Driver state snapshots recorded by DriverRender, in tick order.
+typedef struct QP_Keyframes {
+    double Interval; // seconds between keyframes, doubled when the list is full
+    int Count;
+    QP_Keyframe Frame[QP_SEEK_MAX_KEYFRAMES];
+} QP_Keyframes;
+
+int  QP_SeekEnable(QP_Context* ctx, double Interval);
+void QP_SeekDisable(QP_Context* ctx);
+void QP_SeekClear(QP_Context* ctx, uint32_t Tick);
+void QP_SeekRecord(QP_Context* ctx);
+int  QP_Seek(QP_Context* ctx, uint32_t Tick);
+
+#endif // SEEK_H_INCLUDED
@@ -16,7 +16,7 @@
 
 void ui_info_track(int id,int ypos)
 {
-    switch(DriverInterface->Type)
+    switch(Context->DriverInterface->Type)
     {
     case DRIVER_QUATTRO:
         return ui_info_q_track(id,ypos);
@@ -29,7 +29,7 @@ void ui_info_track(int id,int ypos)
 
 void ui_info_voice(int id,int ypos)
 {
-    switch(DriverInterface->Type)
+    switch(Context->DriverInterface->Type)
     {
     case DRIVER_QUATTRO:
         return ui_info_q_voice(id,ypos);
@@ -20,7 +20,7 @@ void ui_info_q_track(int id,int ypos)
     int i, j, x, y;
     uint8_t note, oct;
 
-    Q_State *Q = DriverInterface->Driver;
+    Q_State *Q = Context->DriverInterface->Driver;
     Q_Track *T = &Q->Track[id];
 
     set_color(ypos,44,6,35,COLOR_D_BLUE,COLOR_L_GREY);
@@ -97,7 +97,7 @@ void ui_info_q_track(int id,int ypos)
     {
     case 0:
         //ui_pattern_disp(id);
-        QP_PatternGenerate(id,&pattern);
+        QP_PatternGenerate(Context,id,&pattern);
 
         if(!pattern.len)
             break;
@@ -297,7 +297,7 @@ void ui_info_q_voice(int id,int ypos)
 {
     int tempypos;
 
-    Q_State *Q = DriverInterface->Driver;
+    Q_State *Q = Context->DriverInterface->Driver;
     Q_Voice* V = &Q->Voice[id];
 
     set_color(ypos,44,43,35,COLOR_D_BLUE,COLOR_L_GREY);
@@ -31,13 +31,13 @@ void scr_about()
         set_color(y,1,h,FCOLUMNS-2,COLOR_D_BLUE,COLOR_L_GREY);
         SCRN(y+1,2,FCOLUMNS-3,"Sound driver settings");
         SCRN(y+3,3,FCOLUMNS-4,"%-20s%s",
-             "Driver", DriverInterface->Name);
+             "Driver", Context->DriverInterface->Name);
         SCRN(y+4,3,FCOLUMNS-4,"%-20s%s",
-             "Driver type",DriverGetDriverInfo());
+             "Driver type",DriverGetDriverInfo(Context));
         SCRN(y+5,3,FCOLUMNS-4,"%-20s%.0f Hz",
-             "Tick rate", DriverGetTickRate());
+             "Tick rate", DriverGetTickRate(Context));
         SCRN(y+6,3,FCOLUMNS-4,"%-20s%.0f Hz",
-             "Chip rate", DriverGetChipRate());
+             "Chip rate", DriverGetChipRate(Context));
 /*
         SCRN(y+4,3,FCOLUMNS-4,"%-20s%s",
              "Driver type", Q_McuNames[QDrv->McuType] );
@@ -46,7 +46,7 @@ void scr_about()
 */
 
         y+=h+1;
-        h=8;
+        h=10;
 
         set_color(y,1,h,FCOLUMNS-2,COLOR_D_BLUE,COLOR_L_GREY);
         SCRN(y+1,2,FCOLUMNS-3,"Audio settings");
@@ -62,6 +62,12 @@ void scr_about()
         snprintf(temp,80,"%d-bit %s",SDL_AUDIO_BITSIZE(af),SDL_AUDIO_ISFLOAT(af)?"Float":"");
         SCRN(y+6,3,FCOLUMNS-4,"%-20s%s",
              "Format",temp);
+        SCRN(y+7,3,FCOLUMNS-4,"%-20s%d",
+             "Render-ahead", Audio->state.Ring.size/Audio->as.channels);
+        SCRN(y+8,3,FCOLUMNS-4,"%-20s%d",
+             "Underruns", SDL_AtomicGet(&Audio->state.Underruns));
+        SCRN(y+9,3,FCOLUMNS-4,"%-20s%d",
+             "Log overflows", SDL_AtomicGet(&Audio->state.LogOverflows));
 
         if(got_input)
             screen_mode = last_scrmode;
@@ -61,8 +61,8 @@ static void generate_items()
     int item_max[ITEM_TYPE_COUNT] = {0};
     int item_type_max = 0;
 
-    item_max[ITEM_SONGREQ] = DriverGetSlotCount();
-    item_max[ITEM_PARAMETER] = DriverGetParameterCount();
+    item_max[ITEM_SONGREQ] = DriverGetSlotCount(Context);
+    item_max[ITEM_PARAMETER] = DriverGetParameterCount(Context);
     item_max[ITEM_VOICE] = 32;
 
     item_cnt=0;
@@ -96,7 +96,7 @@ static int item_check_overflow(struct main2_item *i,int value)
     switch(i->type)
     {
     case ITEM_SONGREQ:
-        return (value >= DriverGetSongCount(i->index));
+        return (value >= DriverGetSongCount(Context,i->index));
     case ITEM_PARAMETER:
         return (value > 0xffff); // temporary
     default:
@@ -110,7 +110,7 @@ static int item_set_overflow(struct main2_item *i,int value)
     {
     case ITEM_SONGREQ:
         if(value<0) value=0;
-        max = DriverGetSongCount(i->index);
+        max = DriverGetSongCount(Context,i->index);
         return (value >= max) ? max-1 : value;
     case ITEM_PARAMETER:
         return (value & 0xffff); // temporary
@@ -123,9 +123,9 @@ static int item_get_value(struct main2_item *i)
     switch(i->type)
     {
     case ITEM_SONGREQ:
-        return DriverGetSongId(i->index);
+        return DriverGetSongId(Context,i->index);
     case ITEM_PARAMETER:
-        return DriverGetParameter(i->index);
+        return DriverGetParameter(Context,i->index);
     default:
         return 0;
     }
@@ -137,11 +137,18 @@ static void item_set_value(struct main2_item *i,int value)
     switch(i->type)
     {
     case ITEM_SONGREQ:
-        Game->PlaylistControl = 0;
-        DriverResetLoopCount();
-        return DriverRequestSong(i->index,value);
+    {
+        QP_Command cmd[] = {
+            {QP_CMD_PLAYLIST,0,0,-1},
+            {QP_CMD_RESET_LOOP_COUNT},
+            {QP_CMD_SONG_REQUEST,0,i->index,value},
+        };
+        ui_commands(cmd,3);
+        return;
+    }
     case ITEM_PARAMETER:
-        return DriverSetParameter(i->index,value);
+        ui_command(QP_CMD_SET_PARAM,i->index,value);
+        return;
     default:
         break;
     }
@@ -152,7 +159,7 @@ static char* item_display_name(struct main2_item *i,char* buffer,int len)
     switch(i->type)
     {
     case ITEM_PARAMETER:
-        if(DriverGetParameterName(i->index,buffer,len))
+        if(DriverGetParameterName(Context,i->index,buffer,len))
             break;
     default:
         snprintf(buffer,len,"%s %02x",item_type_name[i->type],i->index);
@@ -167,9 +174,9 @@ static char* item_display_value(struct main2_item *i,char* buffer,int len)
     switch(i->type)
     {
     case ITEM_VOICE:
-        if(DriverGetSolo()>>i->index & 1)
+        if(DriverGetSolo(Context)>>i->index & 1)
             snprintf(buffer,len,"%s (Solo)",buffer);
-        if(DriverGetMute()>>i->index & 1)
+        if(DriverGetMute(Context)>>i->index & 1)
             snprintf(buffer,len,"%s (Mute)",buffer);
         break;
     default:
@@ -178,8 +185,8 @@ static char* item_display_value(struct main2_item *i,char* buffer,int len)
 
         if(i->type == ITEM_SONGREQ)
         {
-            int status = DriverGetSongStatus(i->index);
-            int loopcnt = DriverGetLoopCount(i->index);
+            int status = DriverGetSongStatus(Context,i->index);
+            int loopcnt = DriverGetLoopCount(Context,i->index);
 
             switch(status&(SONG_STATUS_STARTING|SONG_STATUS_PLAYING))
             {
@@ -187,7 +194,7 @@ static char* item_display_value(struct main2_item *i,char* buffer,int len)
             default:
                 break;
             case SONG_STATUS_PLAYING:
-                songtime = DriverGetPlayingTime(i->index);
+                songtime = DriverGetPlayingTime(Context,i->index);
                 if(status & SONG_STATUS_SUBSONG)
                     snprintf(buffer,len,"%s (Sub)",buffer);
                 else if(loopcnt>0)
@@ -261,12 +268,17 @@ static void check_input()
             switch(item[select_pos].type)
             {
             case ITEM_SONGREQ:
-                Game->PlaylistControl = 0;
-                DriverResetLoopCount();
-                DriverStopSong(item[select_pos].index);
+            {
+                QP_Command cmd[] = {
+                    {QP_CMD_PLAYLIST,0,0,-1},
+                    {QP_CMD_RESET_LOOP_COUNT},
+                    {QP_CMD_SONG_STOP,0,item[select_pos].index,0},
+                };
+                ui_commands(cmd,3);
                 break;
+            }
             case ITEM_VOICE:
-                DriverSetSolo(DriverGetSolo() ^ 1<<item[select_pos].index);
+                ui_command(QP_CMD_TOGGLE_SOLO,1<<item[select_pos].index,0);
                 break;
             }
 
@@ -291,7 +303,7 @@ void scr_main2()
     set_color(3,1,1,FCOLUMNS-2,COLOR_D_BLUE|CFLAG_YSHIFT_25,COLOR_L_GREY);
     set_color(5,1,FROWS-7,FCOLUMNS-2,COLOR_D_BLUE,COLOR_L_GREY);
     set_color(49,0,1,FCOLUMNS,COLOR_D_BLUE,COLOR_L_GREY);
-    SCRN(1,1,FCOLUMNS-2,"%s",DriverGetSongMessage());
+    SCRN(1,1,FCOLUMNS-2,"%s",DriverGetSongMessage(Context));
     SCRN(3,1,FCOLUMNS-2,"Sound driver interface");
 
     if(item_cnt == 0)
@@ -8,6 +8,7 @@
 #include "ui.h"
 
 #define PLPAGE (FROWS-7)
+#define SEEK_STEP 10 // seconds
     static int select_pos;
     static int pl_mode;
     static int kbd_transpose;
@@ -54,13 +55,23 @@ void scr_playlist_input2()
 
 }
 
-void scr_playlist_input()
+// Skip the boot song, called from the audio thread.
+static void skip_boot_song(QP_Context *ctx,void *data)
 {
-    SDL_LockAudioDevice(Audio->dev);
+    if(ctx->DriverInterface->Type == DRIVER_QUATTRO)
+    {
+        Q_State *Q = ctx->DriverInterface->Driver;
+        if(Q->BootSong)
+            Q->Track[0].SkipTrack=1;
+    }
+}
 
+void scr_playlist_input()
+{
     got_input=0;
 
     int increment=1;
+    int seek;
 
     switch(keycode)
     {
@@ -80,45 +91,52 @@ void scr_playlist_input()
         select_pos_check();
         break;
     case SDLK_RETURN:
+    {
+        QP_Command cmd[2];
+        int count = 0;
         // force skip the boot song if RETURN is pressed twice
         // while boot song still playing
-        if(Game->PlaylistControl==2 && DriverInterface->Type == DRIVER_QUATTRO)
-        {
-            Q_State *Q = DriverInterface->Driver;
-            if(Q->BootSong)
-                Q->Track[0].SkipTrack=1;
-        }
+        if(Game->PlaylistControl==2)
+            cmd[count++] = (QP_Command){QP_CMD_CALL,0,0,0,skip_boot_song,NULL};
         select_pos_check();
-        Game->PlaylistPosition=select_pos;
+        cmd[count++] = (QP_Command){QP_CMD_PLAYLIST,0,2,select_pos};
+        ui_commands(cmd,count);
+        break;
+    }
     case SDLK_r:
-        Game->PlaylistControl=2;
+        ui_command(QP_CMD_PLAYLIST,2,-1);
         break;
     case SDLK_f:
     case SDLK_s:
-        Game->PlaylistControl = 0;
+    {
         int SongReq = Game->PlaylistSongID & 0x800 ? 8 : 0;
-        if(keycode==SDLK_f)
-            DriverFadeOutSong(SongReq);
-        if(keycode==SDLK_s)
-            DriverStopSong(SongReq);
+        QP_Command cmd[] = {
+            {QP_CMD_PLAYLIST,0,0,-1},
+            {keycode==SDLK_f ? QP_CMD_SONG_FADE : QP_CMD_SONG_STOP,0,SongReq,0},
+        };
+        ui_commands(cmd,2);
+        break;
+    }
+    case SDLK_LEFT:
+    case SDLK_RIGHT:
+        seek = (keycode == SDLK_LEFT ? -SEEK_STEP : SEEK_STEP)*DriverGetTickRate(Context);
+        seek += (int)__atomic_load_n(&Context->TickCount,__ATOMIC_RELAXED);
+        ui_command(QP_CMD_SEEK,seek < 0 ? 0 : seek,0);
+        NOTICE("Seek %s %d seconds",keycode == SDLK_LEFT ? "back" : "forward",SEEK_STEP);
         break;
     case SDLK_n:
         select_pos = Game->PlaylistPosition+1;
         select_pos_check();
-        Game->PlaylistPosition=select_pos;
-        Game->PlaylistControl=2;
+        ui_command(QP_CMD_PLAYLIST,2,select_pos);
         break;
     case SDLK_b:
         select_pos = Game->PlaylistPosition-1;
         select_pos_check();
-        Game->PlaylistPosition=select_pos;
-        Game->PlaylistControl=2;
+        ui_command(QP_CMD_PLAYLIST,2,select_pos);
         break;
     default:
         got_input=1;
     }
-
-    SDL_UnlockAudioDevice(Audio->dev);
 }
 
 #define MAX_VOICES 32
@@ -129,7 +147,7 @@ void scr_playlist_kbd()
     int16_t pitch;
     int has_drums=0;
 
-    int cnt = DriverGetVoiceCount();
+    int cnt = DriverGetVoiceCount(Context);
     if(!cnt)
         return;
     if(cnt>MAX_VOICES) cnt=MAX_VOICES;
@@ -141,7 +159,7 @@ void scr_playlist_kbd()
     // Get voice info
     for(i=0;i<cnt;i++)
     {
-        if(!DriverGetVoiceInfo(i,&vi[id]))
+        if(!DriverGetVoiceInfo(Context,i,&vi[id]))
         {
             if((vi[id].VoiceType&0x0f) == VOICE_TYPE_PERCUSSION)
             {
@@ -264,8 +282,26 @@ void scr_playlist_kbd()
     free(vi);
 }
 
+// song length from the cache, "intro+loop" for looping songs
+static void scr_playlist_length(char* buf,int size,int entry)
+{
+    QP_ScanResult* r = QP_CacheFindEntry(Game,entry);
+    int intro, loop;
+
+    *buf = 0;
+    if(!r || r->Status == QP_SCAN_TIMEOUT || !r->ChipRate)
+        return;
+    intro = r->IntroSamples/r->ChipRate;
+    loop = r->LoopSamples/r->ChipRate;
+    if(r->Status == QP_SCAN_LOOPED)
+        snprintf(buf,size,"%d:%02d+%d:%02d",intro/60,intro%60,loop/60,loop%60);
+    else
+        snprintf(buf,size,"%d:%02d",intro/60,intro%60);
+}
+
 void scr_playlist_list(int ypos,int height)
 {
+    char length[32];
     int y = 0;
     int i = select_pos;
     int offset = 0;
@@ -289,7 +325,9 @@ void scr_playlist_list(int ypos,int height)
 
         set_color(ypos+y,1,1,FCOLUMNS-2,bg,fg);
 
-        SCRN(ypos+y,1,FCOLUMNS-2,"%02d %s",i+1,Game->Playlist[i].Title);
+        scr_playlist_length(length,sizeof(length),i);
+        SCRN(ypos+y,1,FCOLUMNS-14,"%02d %s",i+1,Game->Playlist[i].Title);
+        SCRN(ypos+y,FCOLUMNS-13,12,"%11s",length);
     }
 }
 
@@ -313,7 +351,7 @@ void scr_playlist()
     set_color(3,1,1,FCOLUMNS-2,COLOR_D_BLUE|CFLAG_YSHIFT_25,COLOR_L_GREY);
     set_color(5,1,FROWS-7,FCOLUMNS-2,COLOR_D_BLUE,COLOR_L_GREY);
     set_color(49,0,1,FCOLUMNS,COLOR_D_BLUE,COLOR_L_GREY);
-    SCRN(1,1,FCOLUMNS-2,"%s",DriverGetSongMessage());
+    SCRN(1,1,FCOLUMNS-2,"%s",DriverGetSongMessage(Context));
 
     int SongReq = Game->PlaylistSongID & 0x800 ? 8 : 0;
 
@@ -343,7 +381,7 @@ void scr_playlist()
 
         if(disp_timer)
         {
-            double songtime = DriverGetPlayingTime(SongReq);
+            double songtime = DriverGetPlayingTime(Context,SongReq);
             SCRN(3,FCOLUMNS-6,6,"%2.0f:%02.0f",
                 floor(songtime/60),floor(fmod(songtime,60)));
         }
@@ -7,6 +7,8 @@
 #include "ui.h"
 #include "scr_main.h"
 
+char QP_DragDropPath[256];
+
 #ifdef DEBUG
 #define RENDER_PROFILING 1
 #endif // DEBUG
@@ -23,6 +25,19 @@
 
 #endif // RENDER_PROFILING
 
+// Queue commands for the driver. The commands of one action are queued
+// together, so a full queue drops the whole action and says so.
+void ui_commands(QP_Command* cmd,int count)
+{
+    if(DriverPushCommands(Context,cmd,count))
+        NOTICE("Command queue full, input ignored");
+}
+void ui_command(enum QP_CommandType type,int arg1,int arg2)
+{
+    QP_Command cmd = {type,0,arg1,arg2,NULL,NULL};
+    ui_commands(&cmd,1);
+}
+
 void ui_drawscreen()
 {
     int i;
@@ -37,8 +52,8 @@ void ui_drawscreen()
         i=SCRN(0,14,60,"Volume: %4.2f [%s] %s",vol,
                  Audio->state.MuteRear ? "Stereo" : " Quad ",
                  Audio->state.FastForward ? "Fast Forward" : "");
-        if(Audio->state.FileLogging)
-            SCRN(0,15+i,20,"Logging %8d ...",Audio->state.LogSamples);
+        if(SDL_AtomicGet(&Audio->state.FileLogging))
+            SCRN(0,15+i,20,"Logging %8d ...",Audio->state.LogFile.samples);
     }
 
     switch(screen_mode)
@@ -87,7 +102,7 @@ void ui_handleinput(SDL_Keysym* ks)
     switch(keycode)
     {
     case SDLK_u:
-        DriverUpdateTick();
+        ui_command(QP_CMD_UPDATE_TICK,0,0);
         break;
     case SDLK_q:
         if(screen_mode == SCR_MAIN || screen_mode == SCR_SELECT)
@@ -134,10 +149,11 @@ void ui_handleinput(SDL_Keysym* ks)
     case SDLK_F3:
         if(gameloaded)
         {
-            Game->PlaylistControl = 0;
-            SDL_LockAudioDevice(Audio->dev);
-            DriverReset(0);
-            SDL_UnlockAudioDevice(Audio->dev);
+            QP_Command cmd[] = {
+                {QP_CMD_PLAYLIST,0,0,-1},
+                {QP_CMD_RESET},
+            };
+            ui_commands(cmd,2);
         }
         else
         {
@@ -150,7 +166,11 @@ void ui_handleinput(SDL_Keysym* ks)
     case SDLK_F6:
         if(gameloaded)
         {
-            DriverResetMute();
+            QP_Command cmd[] = {
+                {QP_CMD_SET_MUTE,0,0,0},
+                {QP_CMD_SET_SOLO,0,0,0},
+            };
+            ui_commands(cmd,2);
         }
         break;
     case SDLK_F7:
@@ -171,18 +191,13 @@ void ui_handleinput(SDL_Keysym* ks)
     case SDLK_F11:
         if(gameloaded)
         {
-            SDL_LockAudioDevice(Audio->dev);
-            if(Audio->state.FileLogging == 0)
-                QP_AudioWavOpen(Audio,"qp_log.wav");
-            else
-                QP_AudioWavClose(Audio);
-            SDL_UnlockAudioDevice(Audio->dev);
+            QP_AudioToggleWavLog(Audio);
         }
         break;
     case SDLK_F12:
         if(kbd[SDL_SCANCODE_LSHIFT] || kbd[SDL_SCANCODE_RSHIFT])
         {
-            DriverDebugAction(DEBUG_ACTION_DISPLAY_INFO);
+            DriverDebugAction(Context,DEBUG_ACTION_DISPLAY_INFO);
         }
         else
         {
@@ -222,8 +237,8 @@ int ui_main(screen_mode_t sm)
     #ifdef DEBUG
     printf("Base gain is %.3f\n",Game->BaseGain);
     printf("Game gain is %.3f\n",Game->Gain);
-    if(DriverInterface)
-        printf("Chip rate is %.0f Hz\n",DriverGetChipRate());
+    if(Context->DriverInterface)
+        printf("Chip rate is %.0f Hz\n",DriverGetChipRate(Context));
     //if(QDrv)
     //    printf("Chip Rate is %d Hz\n",QDrv->Chip.rate);
     #endif
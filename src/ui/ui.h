@@ -18,6 +18,13 @@
 #define FROWS 50
 
 #include "lib.h"
+#include "../audio.h"
+
+extern char QP_DragDropPath[256];
+
+// defined in main.c
+extern QP_Context *Context;
+extern QP_Game *Game; // same as Context->Game
 
     int FSIZE_X;
     int FSIZE_Y;
@@ -69,6 +76,9 @@ enum {
 
 int ui_main(screen_mode_t);
 
+void ui_commands(QP_Command* cmd,int count);
+void ui_command(enum QP_CommandType type,int arg1,int arg2);
+
 void scr_main();
 void scr_main2();
 void scr_about();